@@ -0,0 +1,23 @@
+#include <assert.h>
+
+unsigned int nondet_uint();
+
+int main()
+{
+  int a[3];
+  unsigned int n = nondet_uint(), m = nondet_uint();
+  __ESBMC_assume(n <= 3 && m <= 1);
+
+  // Needs to be unwound 3 times
+  for (unsigned int i = 0; i < n; i++)
+    a[i] = i;
+
+  // Needs no deepening
+  int s = 0;
+  for (unsigned int j = 0; j < m; j++)
+    s++;
+
+  assert(n == 0 || a[n - 1] == n - 1);
+  assert(s <= 1);
+  return 0;
+}
@@ -0,0 +1,3 @@
+#define LIMIT 10
+
+int nondet_int();
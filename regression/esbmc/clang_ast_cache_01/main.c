@@ -0,0 +1,11 @@
+#include <assert.h>
+#include "defs.h"
+
+int main()
+{
+  int x = nondet_int();
+  __ESBMC_assume(x < LIMIT);
+  // The header of the cache must not shift this line
+  assert(x < LIMIT - 1);
+  return 0;
+}
@@ -0,0 +1,22 @@
+#include <assert.h>
+
+int nondet_int();
+
+struct S
+{
+  int a;
+  char c;
+  short h;
+  int d;
+};
+
+int main()
+{
+  struct S s = {1, 2, 3, 4};
+  int *p = nondet_int() ? &s.a : &s.d;
+  assert(*p == 1 || *p == 4);
+  *p = 7;
+  assert(s.a == 7 || s.d == 7);
+  assert(s.c == 2 && s.h == 3);
+  return 0;
+}
@@ -0,0 +1,20 @@
+#include <assert.h>
+
+int nondet_int();
+
+struct S
+{
+  int a;
+  char c;
+  short h;
+  int d;
+};
+
+int main()
+{
+  struct S s = {1, 2, 3, 4};
+  int *p = nondet_int() ? &s.a : &s.d;
+  *p = 7;
+  assert(s.d == 4);
+  return 0;
+}
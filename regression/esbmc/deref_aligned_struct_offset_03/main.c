@@ -0,0 +1,25 @@
+#include <assert.h>
+
+int nondet_int();
+
+struct T
+{
+  int d;
+  short a;
+  short b;
+};
+
+struct O
+{
+  struct T x, y;
+};
+
+int main()
+{
+  struct O o = {{1, 2, 3}, {4, 5, 6}};
+  struct T *p = nondet_int() ? &o.x : &o.y;
+  p->b = 7;
+  // the write must not be lost
+  assert(o.x.b != 7 && o.y.b != 7);
+  return 0;
+}
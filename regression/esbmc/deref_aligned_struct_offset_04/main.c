@@ -0,0 +1,26 @@
+#include <assert.h>
+
+int nondet_int();
+
+struct T
+{
+  int d;
+  short a;
+  short b;
+};
+
+struct O
+{
+  struct T x, y;
+};
+
+int main()
+{
+  struct O o = {{1, 2, 3}, {4, 5, 6}};
+  struct T *p = nondet_int() ? &o.x : &o.y;
+  assert(p->b == 3 || p->b == 6);
+  p->b = 7;
+  assert(o.x.b == 7 || o.y.b == 7);
+  assert(o.x.a == 2 && o.y.a == 5);
+  return 0;
+}
@@ -0,0 +1,13 @@
+#include <assert.h>
+
+int main()
+{
+  int a[300];
+  unsigned s = 5;
+  for (int i = 0; i < 300; i++)
+    a[(long)i] = 7;
+  for (int i = 0; i < 10; i++)
+    s = s + 3;
+  assert(a[299] == 7 && s == 35);
+  return 0;
+}
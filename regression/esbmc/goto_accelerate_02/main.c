@@ -0,0 +1,11 @@
+#include <assert.h>
+
+int main()
+{
+  int a[300];
+  // Only the first 256 elements are written
+  for (int i = 0; i < 300; i++)
+    a[(unsigned char)i] = 7;
+  assert(a[299] == 7);
+  return 0;
+}
@@ -0,0 +1,15 @@
+#include <assert.h>
+
+int main()
+{
+  int x = 1, a = 0;
+  // Always jumped over: symex moves straight to the assertion
+  if (x == 0)
+  {
+    while (a < 10)
+      a++;
+    assert(a == 10);
+  }
+  assert(a == 0);
+  return 0;
+}
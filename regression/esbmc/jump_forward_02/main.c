@@ -0,0 +1,14 @@
+#include <assert.h>
+
+int main()
+{
+  int x = 1, a = 0;
+  // The skipped block declares a variable: symex walks it instead
+  if (x == 0)
+  {
+    int b = 1;
+    a = b;
+  }
+  assert(a == 0);
+  return 0;
+}
@@ -0,0 +1,17 @@
+#include <assert.h>
+
+#define A10 a++; a++; a++; a++; a++; a++; a++; a++; a++; a++;
+#define A100 A10 A10 A10 A10 A10 A10 A10 A10 A10 A10
+#define A1000 A100 A100 A100 A100 A100 A100 A100 A100 A100 A100
+
+int main()
+{
+  int x = 1, a = 0;
+  // Always jumped over: the skipped range must not count towards --depth
+  if (x == 0)
+  {
+    A1000
+  }
+  assert(a != 0);
+  return 0;
+}
@@ -0,0 +1,22 @@
+#include <assert.h>
+#include <pthread.h>
+
+int x;
+
+void *inc(void *arg)
+{
+  int tmp = x;
+  x = tmp + 1;
+  return NULL;
+}
+
+int main()
+{
+  pthread_t t1, t2;
+  pthread_create(&t1, 0, inc, 0);
+  pthread_create(&t2, 0, inc, 0);
+  pthread_join(t1, 0);
+  pthread_join(t2, 0);
+  assert(x == 2);
+  return 0;
+}
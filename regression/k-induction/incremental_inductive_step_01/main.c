@@ -0,0 +1,20 @@
+#include <assert.h>
+
+int nondet_int();
+
+int main()
+{
+  int a = 1, b = 2, c = 3, t;
+  int n = nondet_int();
+
+  // Only proved by the inductive step for k = 3
+  for (int i = 0; i < n; i++)
+  {
+    assert(a != b);
+    t = a;
+    a = b;
+    b = c;
+    c = t;
+  }
+  return 0;
+}
@@ -0,0 +1,17 @@
+#include <assert.h>
+
+int main()
+{
+  int sn = 0;
+  unsigned int x = 0;
+
+  // The inductive step must fail for every k until the base case
+  // finds the violation at x = 11
+  while (1)
+  {
+    if (x < 10)
+      sn = sn + 2;
+    x++;
+    assert(sn == x * 2 || sn == 0);
+  }
+}
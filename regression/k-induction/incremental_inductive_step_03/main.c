@@ -0,0 +1,19 @@
+#include <assert.h>
+#include <pthread.h>
+
+int g = 0;
+
+void *t(void *arg)
+{
+  g = 1;
+  return NULL;
+}
+
+int main()
+{
+  pthread_t id;
+  pthread_create(&id, NULL, t, NULL);
+
+  while (1)
+    assert(g == 0 || g == 1);
+}
@@ -0,0 +1,24 @@
+#include <assert.h>
+#include <pthread.h>
+
+int g = 0;
+
+void *t(void *arg)
+{
+  g = 1;
+  return NULL;
+}
+
+int main()
+{
+  pthread_t id;
+  pthread_create(&id, NULL, t, NULL);
+
+  unsigned int i = 0;
+  while (1)
+  {
+    i++;
+    if (i == 4)
+      assert(g == 0);
+  }
+}
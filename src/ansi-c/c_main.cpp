@@ -64,16 +64,16 @@ bool c_main(contextt &context, const std::string &standard_main)
 
   std::list<irep_idt> matches;
 
-  forall_symbol_base_map (it, context.symbol_base_map, themain)
+  forall_symbol_base_map (id, context.symbol_base_map, themain)
   {
     // look it up
-    symbolt *s = context.find_symbol(it->second);
+    symbolt *s = context.find_symbol(id);
 
     if (s == nullptr)
       continue;
 
     if (s->type.is_code())
-      matches.push_back(it->second);
+      matches.push_back(id);
   }
 
   if (matches.empty())
@@ -268,12 +268,31 @@ digit_div(onedig_t *r, const onedig_t *y, unsigned yl, onedig_t *q, unsigned ql)
   }
 }
 
+// Free the digit string if it lives on the heap.
+inline void BigInt::release()
+{
+  if (on_heap())
+  {
+    memset(digit, 0, size * sizeof digit[0]); // Crypto-paranoia.
+    delete[] digit;
+  }
+}
+
 // Newly allocate uninitialized space for specified number of digits.
+// The inline buffer is used when they fit in it.
 inline void BigInt::allocate(unsigned digits)
 {
-  size = adjust_size(digits);
   length = 0;
-  digit = new onedig_t[size];
+  if (digits <= inline_size)
+  {
+    size = inline_size;
+    digit = inline_digit;
+  }
+  else
+  {
+    size = adjust_size(digits);
+    digit = new onedig_t[size];
+  }
 }
 
 // Used in assignment: When smaller than specified digits, allocate
@@ -282,10 +301,10 @@ inline void BigInt::reallocate(unsigned digits)
 {
   if (digits > size)
   {
-    if (size)
-      delete[] digit;
-    size = adjust_size(digits);
-    digit = new onedig_t[size];
+    unsigned len = length;
+    release();
+    allocate(digits);
+    length = len;
   }
 }
 
@@ -295,14 +314,15 @@ inline void BigInt::resize(unsigned digits)
   if (digits > size)
   {
     onedig_t *old_digit = digit;
-    unsigned old_size = size;
-    size = adjust_size(digits);
-    digit = new onedig_t[size];
+    bool old_on_heap = on_heap();
+    unsigned len = length;
+    allocate(digits);
+    length = len;
 
     if (old_digit != nullptr)
     {
       memcpy(digit, old_digit, length * sizeof(onedig_t));
-      if (old_size)
+      if (old_on_heap)
         delete[] old_digit;
     }
   }
@@ -365,11 +385,7 @@ void BigInt::assign(llong_t l)
 
 BigInt::~BigInt()
 {
-  if (size > 0)
-  {
-    memset(digit, 0, size * sizeof digit[0]); // Crypto-paranoia.
-    delete[] digit;
-  }
+  release();
 }
 
 BigInt::BigInt(onedig_t *dig, unsigned len, bool pos)
@@ -378,55 +394,50 @@ BigInt::BigInt(onedig_t *dig, unsigned len, bool pos)
 }
 
 BigInt::BigInt()
-  : size(adjust_size(small)),
-    length(0),
-    digit(new onedig_t[size]),
-    positive(true)
+  : size(inline_size), length(0), digit(inline_digit), positive(true)
 {
 }
 
 BigInt::BigInt(signed long int n)
-  : size(adjust_size(small)), length(0), digit(new onedig_t[size])
+  : size(inline_size), length(0), digit(inline_digit)
 {
   assign(llong_t(n));
 }
 
 BigInt::BigInt(unsigned long int n)
-  : size(adjust_size(small)), length(0), digit(new onedig_t[size])
+  : size(inline_size), length(0), digit(inline_digit)
 {
   assign(ullong_t(n));
 }
 
 BigInt::BigInt(int n)
-  : size(adjust_size(small)), length(0), digit(new onedig_t[size])
+  : size(inline_size), length(0), digit(inline_digit)
 {
   assign(llong_t(n));
 }
 
 BigInt::BigInt(unsigned u)
-  : size(adjust_size(small)), length(0), digit(new onedig_t[size])
+  : size(inline_size), length(0), digit(inline_digit)
 {
   assign(ullong_t(u));
 }
 
 BigInt::BigInt(llong_t l)
-  : size(adjust_size(small)), length(0), digit(new onedig_t[size])
+  : size(inline_size), length(0), digit(inline_digit)
 {
   assign(l);
 }
 
 BigInt::BigInt(ullong_t ul)
-  : size(adjust_size(small)), length(0), digit(new onedig_t[size])
+  : size(inline_size), length(0), digit(inline_digit)
 {
   assign(ul);
 }
 
-BigInt::BigInt(BigInt const &y)
-  : size(adjust_size(y.length)),
-    length(y.length),
-    digit(new onedig_t[size]),
-    positive(y.positive)
+BigInt::BigInt(BigInt const &y) : positive(y.positive)
 {
+  allocate(y.length);
+  length = y.length;
   memcpy(digit, y.digit, length * sizeof(onedig_t));
 }
 
@@ -436,10 +447,7 @@ BigInt::BigInt(BigInt &&y) : BigInt()
 }
 
 BigInt::BigInt(char const *s, onedig_t b)
-  : size(adjust_size(small)),
-    length(0),
-    digit(new onedig_t[size]),
-    positive(true)
+  : size(inline_size), length(0), digit(inline_digit), positive(true)
 {
   scan(s, b);
 }
@@ -814,10 +822,11 @@ void BigInt::mul(onedig_t const *dig, unsigned len, bool pos)
   }
   else
   {
-    // Get a new string of digits for the result.
-    unsigned old_size = size;
-    size = adjust_size(length + len);
-    onedig_t *r = new onedig_t[size];
+    // Get a new string of digits for the result. Short products are
+    // computed on the stack as the inline buffer may be an operand.
+    onedig_t tmp[inline_size];
+    unsigned r_size = adjust_size(length + len);
+    onedig_t *r = length + len <= inline_size ? tmp : new onedig_t[r_size];
 
     // The first parameter pair defines the outer loop which should
     // be the shorter.
@@ -827,9 +836,18 @@ void BigInt::mul(onedig_t const *dig, unsigned len, bool pos)
       digit_mul(dig, len, digit, length, r);
 
     // Replace digit string of this with result.
-    if (old_size)
-      delete[] digit;
-    digit = r;
+    release();
+    if (r == tmp)
+    {
+      size = inline_size;
+      digit = inline_digit;
+      memcpy(digit, tmp, (length + len) * sizeof(onedig_t));
+    }
+    else
+    {
+      size = r_size;
+      digit = r;
+    }
     length += len;
     adjust();
   }
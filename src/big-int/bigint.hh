@@ -100,11 +100,27 @@ public:
     small = sizeof(ullong_t) / sizeof(onedig_t)
   };
 
+  // Number of digits kept inside the object itself. Values of up to twice
+  // the width of an ullong_t (e.g. the product of two of them) never touch
+  // the heap.
+  enum
+  {
+    inline_size = 2 * small
+  };
+
 private:
   unsigned size;   // Length of digit vector.
   unsigned length; // Used places in digit vector.
   onedig_t *digit; // Least significant first.
   bool positive;   // Signed magnitude representation.
+  onedig_t inline_digit[inline_size];
+
+  // Whether digit points to heap storage owned by this.
+  bool on_heap() const
+  {
+    return size != 0 && digit != inline_digit;
+  }
+  inline void release();
 
   // Create or resize this.
   inline void allocate(unsigned digits);
@@ -324,10 +340,17 @@ public:
 
   void swap(BigInt &other)
   {
+    const bool this_inline = digit == inline_digit;
+    const bool other_inline = other.digit == other.inline_digit;
     std::swap(other.size, size);
     std::swap(other.length, length);
     std::swap(other.digit, digit);
     std::swap(other.positive, positive);
+    std::swap(other.inline_digit, inline_digit);
+    if (other_inline)
+      digit = inline_digit;
+    if (this_inline)
+      other.digit = other.inline_digit;
   }
 
 private:
@@ -90,7 +90,7 @@ public:
     std::ofstream out(
       cmdline.getval("output"), std::ios::out | std::ios::binary);
 
-    if (write_goto_binary(out, context, goto_functions))
+    if (write_goto_binary(out, context, goto_functions, true))
     {
       log_error("Failed to write C library to binary obj");
       return 1;
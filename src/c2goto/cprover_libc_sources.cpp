@@ -16,13 +16,14 @@ extern "C"
 
 /* This class represents the extracted internal libc. It uses the headers
  * generated by the build system to dump the bundled libc/libm files in a
- * temporary directory. The headers contain invocations of the form
- * ESBMC_FLAIL(body, size, name) for each bundled file,
- * see scripts/flail.py --macro. */
+ * temporary directory, while the libc headers are only kept in memory. The
+ * headers contain invocations of the form ESBMC_FLAIL(body, size, name) for
+ * each bundled file, see scripts/flail.py --macro. */
 static class
 {
   file_operations::tmp_path base;
   std::string libc, libm, headers;
+  file_operations::virtual_filest header_files;
 
   const std::string &base_path()
   {
@@ -48,27 +49,22 @@ public:
   {
     if (headers == "")
     {
-      using namespace boost::filesystem;
-      headers = base_path() + "/headers";
-      create_directory(headers);
-      create_directory(headers + "/__esbmc");
-      create_directory(headers + "/bits");
-      create_directory(headers + "/sys");
-      create_directory(headers + "/sys/_types");
-      create_directory(headers + "/sys/_pthread");
-      create_directory(headers + "/ubuntu20.04");
-      create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76");
-      create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include");
-      create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include/linux");
-      create_directory(headers + "/ubuntu20.04/kernel_5.15.0-76/include/asm");
+      headers = file_operations::virtual_root() + "/libc";
 #define ESBMC_FLAIL(body, size, ...)                                           \
-  std::ofstream(headers + "/" #__VA_ARGS__).write(body, size);
+  header_files.emplace_back(                                                   \
+    headers + "/" #__VA_ARGS__, std::string(body, size));
 #include <headers/libc_hdr.h>
 #undef ESBMC_FLAIL
     }
     return headers;
   }
 
+  const file_operations::virtual_filest &header_contents()
+  {
+    header_dir();
+    return header_files;
+  }
+
   template <typename F>
   void foreach_libc_libm(F &&f)
   {
@@ -97,6 +93,11 @@ const std::string *internal_libc_header_dir()
            : &internal_libc.header_dir();
 }
 
+const file_operations::virtual_filest &internal_libc_header_files()
+{
+  return internal_libc.header_contents();
+}
+
 /* copy of clang_c_convertert::get_filename_from_path(); TODO: unify */
 static std::string get_filename_from_path(std::string path)
 {
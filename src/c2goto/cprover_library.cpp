@@ -5,6 +5,7 @@
 #include <fstream>
 #include <goto-programs/goto_binary_reader.h>
 #include <goto-programs/goto_functions.h>
+#include <goto-programs/symbol_deps.h>
 #include <util/c_link.h>
 #include <util/config.h>
 #include <util/language.h>
@@ -92,78 +93,13 @@ const static std::vector<std::string> python_c_models = {"strncmp"};
 
 } // namespace
 
-static void generate_symbol_deps(
-  irep_idt name,
-  irept irep,
-  std::multimap<irep_idt, irep_idt> &deps)
+/* Add two hacks; we might use either pthread_mutex_lock or the checked
+ * variant; so if one version is used, pull in the other too. */
+static void add_symbol_deps_hacks(symbol_depst &deps)
 {
-  std::pair<irep_idt, irep_idt> type;
-
-  if (irep.id() == "symbol")
-  {
-    type = std::pair<irep_idt, irep_idt>(name, irep.identifier());
-    deps.insert(type);
-    return;
-  }
-
-  forall_irep (irep_it, irep.get_sub())
-  {
-    if (irep_it->id() == "symbol")
-    {
-      type = std::pair<irep_idt, irep_idt>(name, irep_it->identifier());
-      deps.insert(type);
-      generate_symbol_deps(name, *irep_it, deps);
-    }
-    else if (irep_it->id() == "argument")
-    {
-      type = std::pair<irep_idt, irep_idt>(name, irep_it->cmt_identifier());
-      deps.insert(type);
-    }
-    else
-    {
-      generate_symbol_deps(name, *irep_it, deps);
-    }
-  }
-
-  forall_named_irep (irep_it, irep.get_named_sub())
-  {
-    if (irep_it->second.id() == "symbol")
-    {
-      type = std::pair<irep_idt, irep_idt>(name, irep_it->second.identifier());
-      deps.insert(type);
-    }
-    else if (irep_it->second.id() == "argument")
-    {
-      type =
-        std::pair<irep_idt, irep_idt>(name, irep_it->second.cmt_identifier());
-      deps.insert(type);
-    }
-    else
-    {
-      generate_symbol_deps(name, irep_it->second, deps);
-    }
-  }
-}
-
-static void ingest_symbol(
-  irep_idt name,
-  std::multimap<irep_idt, irep_idt> &deps,
-  std::list<irep_idt> &to_include)
-{
-  std::pair<
-    std::multimap<irep_idt, irep_idt>::const_iterator,
-    std::multimap<irep_idt, irep_idt>::const_iterator>
-    range;
-  std::multimap<irep_idt, irep_idt>::const_iterator it;
-
-  range = deps.equal_range(name);
-  if (range.first == range.second)
-    return;
-
-  for (it = range.first; it != range.second; it++)
-    to_include.push_back(it->second);
-
-  deps.erase(name);
+  deps[dstring("pthread_mutex_lock")].emplace_back("pthread_mutex_lock_check");
+  deps[dstring("pthread_cond_wait")].emplace_back("pthread_cond_wait_check");
+  deps[dstring("pthread_join")].emplace_back("pthread_join_noswitch");
 }
 
 void add_cprover_library(contextt &context, const languaget *language)
@@ -173,8 +109,7 @@ void add_cprover_library(contextt &context, const languaget *language)
 
   contextt new_ctx, store_ctx;
   goto_functionst goto_functions;
-  std::multimap<irep_idt, irep_idt> symbol_deps;
-  std::list<irep_idt> to_include;
+  symbol_depst symbol_deps;
   const buffer *clib;
 
   switch (config.ansi_c.word_size)
@@ -203,61 +138,67 @@ void add_cprover_library(contextt &context, const languaget *language)
   }
 
   goto_binary_reader goto_reader;
-
-  if (language && language->id() == "python")
-    goto_reader.set_functions_to_read(python_c_models);
-
-  if (goto_reader.read_goto_binary_array(
-        clib->start, clib->size, new_ctx, goto_functions))
+  bool is_python = language && language->id() == "python";
+
+  /* Binaries produced by c2goto carry an index of each symbol's direct
+   * dependencies. With it, we can work out which library symbols the program
+   * needs before decoding any of them and then convert just those. */
+  if (
+    !is_python && goto_reader.read_goto_binary_array_deps(
+                    clib->start, clib->size, symbol_deps))
     abort();
 
-  new_ctx.foreach_operand([&symbol_deps](const symbolt &s) {
-    generate_symbol_deps(s.id, s.value, symbol_deps);
-    generate_symbol_deps(s.id, s.type, symbol_deps);
-  });
+  if (!symbol_deps.empty())
+  {
+    add_symbol_deps_hacks(symbol_deps);
+
+    std::vector<irep_idt> roots;
+    for (const auto &[name, deps] : symbol_deps)
+    {
+      const symbolt *symbol = context.find_symbol(name);
+      if (symbol != nullptr && symbol->value.is_nil())
+        roots.push_back(name);
+    }
 
-  // Add two hacks; we might use either pthread_mutex_lock or the checked
-  // variant; so if one version is used, pull in the other too.
-  std::pair<irep_idt, irep_idt> lockcheck(
-    dstring("pthread_mutex_lock"), dstring("pthread_mutex_lock_check"));
-  symbol_deps.insert(lockcheck);
+    symbol_id_sett needed;
+    symbol_deps_closure(symbol_deps, std::move(roots), needed);
+    if (needed.empty())
+      return;
 
-  std::pair<irep_idt, irep_idt> condcheck(
-    dstring("pthread_cond_wait"), dstring("pthread_cond_wait_check"));
-  symbol_deps.insert(condcheck);
+    goto_reader.set_symbols_to_read(std::move(needed));
+    if (goto_reader.read_goto_binary_array(
+          clib->start, clib->size, store_ctx, goto_functions))
+      abort();
+  }
+  else
+  {
+    if (is_python)
+      goto_reader.set_functions_to_read(python_c_models);
 
-  std::pair<irep_idt, irep_idt> joincheck(
-    dstring("pthread_join"), dstring("pthread_join_noswitch"));
-  symbol_deps.insert(joincheck);
+    if (goto_reader.read_goto_binary_array(
+          clib->start, clib->size, new_ctx, goto_functions))
+      abort();
 
-  /* The code just pulled into store_ctx might use other symbols in the C
-   * library. So, repeatedly search for new C library symbols that we use but
-   * haven't pulled in, then pull them in. We finish when we've made a pass
-   * that adds no new symbols. */
+    collect_symbol_deps(new_ctx, symbol_deps);
+    add_symbol_deps_hacks(symbol_deps);
 
-  new_ctx.foreach_operand(
-    [&context, &store_ctx, &symbol_deps, &to_include, &language](
-      const symbolt &s) {
+    /* The code pulled into store_ctx might use other symbols in the C
+     * library. So, pull in everything reachable from the symbols we use but
+     * haven't defined. */
+    std::vector<irep_idt> roots;
+    new_ctx.foreach_operand([&context, &roots, is_python](const symbolt &s) {
       const symbolt *symbol = context.find_symbol(s.id);
-      if (
-        (language && language->id() == "python") ||
-        (symbol != nullptr && symbol->value.is_nil()))
-      {
-        store_ctx.add(s);
-        ingest_symbol(s.id, symbol_deps, to_include);
-      }
+      if (is_python || (symbol != nullptr && symbol->value.is_nil()))
+        roots.push_back(s.id);
     });
 
-  for (std::list<irep_idt>::const_iterator nameit = to_include.begin();
-       nameit != to_include.end();
-       nameit++)
-  {
-    symbolt *s = new_ctx.find_symbol(*nameit);
-    if (s != nullptr)
-    {
-      store_ctx.add(*s);
-      ingest_symbol(*nameit, symbol_deps, to_include);
-    }
+    symbol_id_sett needed;
+    symbol_deps_closure(symbol_deps, std::move(roots), needed);
+
+    new_ctx.foreach_operand([&store_ctx, &needed](const symbolt &s) {
+      if (needed.count(s.id))
+        store_ctx.add(s);
+    });
   }
 
   if (c_link(context, store_ctx, "<built-in-library>"))
@@ -2,15 +2,19 @@
 #define CPROVER_ANSI_C_CPROVER_LIBRARY_H
 
 #include <util/context.h>
+#include <util/filesystem.h>
 #include <util/message.h>
 
 class languaget;
 
-/* Returns the path the headers of the internal libc have been extracted to
- * or NULL if no library is configured (either via config.ansi_c.lib or during
- * build time). */
+/* Returns the virtual path of the headers of the internal libc or NULL if no
+ * library is configured (either via config.ansi_c.lib or during build time).
+ * The headers themselves are given by internal_libc_header_files(). */
 const std::string *internal_libc_header_dir();
 
+/* The headers of the internal libc, to be served from memory. */
+const file_operations::virtual_filest &internal_libc_header_files();
+
 /* Adds the internal libc to `context` by parsing and linking all C sources.
  *
  * Note that parsing the entire ESBMC standard library is a slow process.
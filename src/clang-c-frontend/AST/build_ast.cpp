@@ -20,6 +20,7 @@ CC_DIAGNOSTIC_IGNORE_LLVM_CHECKS()
 #else
 #  include <llvm/TargetParser/Host.h>
 #endif
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/Path.h>
 CC_DIAGNOSTIC_POP()
 
@@ -53,31 +54,13 @@ static clang::driver::Driver *newDriver(
   return CompilerDriver;
 }
 
-std::unique_ptr<clang::ASTUnit> buildASTs(
-  const std::string &intrinsics,
-  const std::vector<std::string> &compiler_args)
+/// Diagnostic options given in `Argv`, copied from ToolInvocation::run
+static llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions>
+newDiagnosticOptions(const std::vector<const char *> &Argv)
 {
-  // Create virtual file system to add clang's headers
-  llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> OverlayFileSystem(
-    new llvm::vfs::OverlayFileSystem(llvm::vfs::getRealFileSystem()));
-
-  llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> InMemoryFileSystem(
-    new llvm::vfs::InMemoryFileSystem);
-  OverlayFileSystem->pushOverlay(InMemoryFileSystem);
-
-  llvm::IntrusiveRefCntPtr<clang::FileManager> Files(
-    new clang::FileManager(clang::FileSystemOptions(), OverlayFileSystem));
-
-  // Create everything needed to create a CompilerInvocation,
-  // copied from ToolInvocation::run
   llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> DiagOpts =
     new clang::DiagnosticOptions();
 
-  std::vector<const char *> Argv;
-  for (const std::string &Str : compiler_args)
-    Argv.push_back(Str.c_str());
-  const char *const BinaryName = Argv[0];
-
   unsigned MissingArgIndex, MissingArgCount;
   llvm::opt::InputArgList ParsedArgs =
     clang::driver::getDriverOptTable().ParseArgs(
@@ -86,15 +69,34 @@ std::unique_ptr<clang::ASTUnit> buildASTs(
       MissingArgCount);
 
   clang::ParseDiagnosticArgs(*DiagOpts, ParsedArgs);
+  return DiagOpts;
+}
 
-  clang::TextDiagnosticPrinter DiagnosticPrinter(llvm::errs(), &*DiagOpts);
+/* Runs the driver over `Argv` and returns the compiler invocation it sets up,
+ * which sees the files in `virtual_files` from memory. */
+static std::shared_ptr<clang::CompilerInvocation> newCompilerInvocation(
+  clang::DiagnosticsEngine *Diagnostics,
+  const std::vector<const char *> &Argv,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files)
+{
+  // Create virtual file system to add clang's headers
+  llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> OverlayFileSystem(
+    new llvm::vfs::OverlayFileSystem(llvm::vfs::getRealFileSystem()));
 
-  clang::DiagnosticsEngine *Diagnostics = new clang::DiagnosticsEngine(
-    llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs>(new clang::DiagnosticIDs()),
-    &*DiagOpts,
-    &DiagnosticPrinter,
-    false);
+  llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> InMemoryFileSystem(
+    new llvm::vfs::InMemoryFileSystem);
+  OverlayFileSystem->pushOverlay(InMemoryFileSystem);
+
+  // The driver looks up the bundled headers through the overlay
+  for (const file_operations::virtual_filest *files : virtual_files)
+    for (const auto &[path, contents] : *files)
+      InMemoryFileSystem->addFile(
+        path, 0, llvm::MemoryBuffer::getMemBuffer(contents, path));
 
+  llvm::IntrusiveRefCntPtr<clang::FileManager> Files(
+    new clang::FileManager(clang::FileSystemOptions(), OverlayFileSystem));
+
+  const char *const BinaryName = Argv[0];
   const std::unique_ptr<clang::driver::Driver> Driver(
     newDriver(Diagnostics, BinaryName, &Files->getVirtualFileSystem()));
 
@@ -119,6 +121,64 @@ std::unique_ptr<clang::ASTUnit> buildASTs(
     llvm::errs() << "\n";
   }
 
+  /* ASTUnit creates its own FileManager on the real file system, so hand the
+   * bundled headers to the preprocessor as remapped files. The buffers only
+   * refer to the contents, which outlive the ASTUnit that frees them. */
+  clang::PreprocessorOptions &PPOpts = Invocation->getPreprocessorOpts();
+  for (const file_operations::virtual_filest *files : virtual_files)
+    for (const auto &[path, contents] : *files)
+      PPOpts.addRemappedFile(
+        path, llvm::MemoryBuffer::getMemBuffer(contents, path).release());
+
+  return Invocation;
+}
+
+/// Makes `Invocation` write the files its input depends on to `path`
+static void setDependencyFile(
+  clang::CompilerInvocation &Invocation,
+  const std::string &path)
+{
+  if (path.empty())
+    return;
+
+  clang::DependencyOutputOptions &DepOpts =
+    Invocation.getDependencyOutputOpts();
+  DepOpts.OutputFile = path;
+  DepOpts.Targets = {"ast"};
+  DepOpts.IncludeSystemHeaders = true;
+}
+
+std::unique_ptr<clang::ASTUnit> buildASTs(
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files,
+  const std::string &dependency_file,
+  std::string *diagnostics)
+{
+  std::vector<const char *> Argv;
+  for (const std::string &Str : compiler_args)
+    Argv.push_back(Str.c_str());
+
+  llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> DiagOpts =
+    newDiagnosticOptions(Argv);
+
+  std::unique_ptr<llvm::raw_string_ostream> DiagnosticStream;
+  if (diagnostics)
+    DiagnosticStream = std::make_unique<llvm::raw_string_ostream>(*diagnostics);
+
+  clang::TextDiagnosticPrinter DiagnosticPrinter(
+    diagnostics ? *DiagnosticStream : llvm::errs(), &*DiagOpts);
+
+  clang::DiagnosticsEngine *Diagnostics = new clang::DiagnosticsEngine(
+    llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs>(new clang::DiagnosticIDs()),
+    &*DiagOpts,
+    &DiagnosticPrinter,
+    false);
+
+  std::shared_ptr<clang::CompilerInvocation> Invocation =
+    newCompilerInvocation(Diagnostics, Argv, virtual_files);
+  setDependencyFile(*Invocation, dependency_file);
+
   // Create our custom action
   auto action = new esbmc_action(std::move(intrinsics));
 
@@ -135,9 +195,54 @@ std::unique_ptr<clang::ASTUnit> buildASTs(
   // See: https://clang.llvm.org/doxygen/ASTUnit_8cpp_source.html#l01510
   delete (action);
 
+  if (DiagnosticStream)
+    DiagnosticStream->flush();
+
   return unit;
 }
 
+bool buildPCH(
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files,
+  const std::string &output_file,
+  const std::string &dependency_file)
+{
+  std::vector<const char *> Argv;
+  for (const std::string &Str : compiler_args)
+    Argv.push_back(Str.c_str());
+
+  llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> DiagOpts =
+    newDiagnosticOptions(Argv);
+
+  // Failing to build the header is not an error, the caller parses instead
+  llvm::IntrusiveRefCntPtr<clang::DiagnosticsEngine> Diagnostics(
+    new clang::DiagnosticsEngine(
+      llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs>(
+        new clang::DiagnosticIDs()),
+      &*DiagOpts,
+      new clang::IgnoringDiagConsumer(),
+      true));
+
+  std::shared_ptr<clang::CompilerInvocation> Invocation =
+    newCompilerInvocation(Diagnostics.get(), Argv, virtual_files);
+  setDependencyFile(*Invocation, dependency_file);
+
+  // The driver set up a syntax-only run over a source file
+  clang::FrontendOptions &FrontendOpts = Invocation->getFrontendOpts();
+  FrontendOpts.OutputFile = output_file;
+  for (clang::FrontendInputFile &Input : FrontendOpts.Inputs)
+    Input =
+      clang::FrontendInputFile(Input.getFile(), Input.getKind().getHeader());
+
+  clang::CompilerInstance Compiler;
+  Compiler.setInvocation(std::move(Invocation));
+  Compiler.setDiagnostics(Diagnostics.get());
+
+  esbmc_pch_action action(intrinsics);
+  return !Compiler.ExecuteAction(action) || Diagnostics->hasErrorOccurred();
+}
+
 void mergeASTs(
   const std::unique_ptr<clang::ASTUnit> &FromUnit,
   std::unique_ptr<clang::ASTUnit> &ToUnit)
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <util/filesystem.h>
 #include <vector>
 
 #define __STDC_LIMIT_MACROS
@@ -14,9 +15,30 @@ namespace clang
 class ASTUnit;
 } // namespace clang
 
+/* Parses the input given in `compiler_args`. The files in `virtual_files`
+ * are made visible to clang from memory, without touching the disk. If
+ * `dependency_file` is not empty, the files the input depends on are written
+ * there in Makefile syntax. Diagnostics go to stderr, or are collected in
+ * `diagnostics` if given, which allows running several instances at once. */
 std::unique_ptr<clang::ASTUnit> buildASTs(
   const std::string &intrinsics,
-  const std::vector<std::string> &compiler_args);
+  const std::vector<std::string> &compiler_args,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files =
+    {},
+  const std::string &dependency_file = "",
+  std::string *diagnostics = nullptr);
+
+/* Writes a precompiled header of the input given in `compiler_args`, with
+ * `intrinsics` and the files in `virtual_files` as in buildASTs(), to
+ * `output_file`. If `dependency_file` is not empty, the files the header
+ * depends on are written there in Makefile syntax. Diagnostics are dropped.
+ * Returns true on error. */
+bool buildPCH(
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files,
+  const std::string &output_file,
+  const std::string &dependency_file = "");
 
 void mergeASTs(
   const std::unique_ptr<clang::ASTUnit> &FromUnit,
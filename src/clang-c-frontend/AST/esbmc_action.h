@@ -41,4 +41,28 @@ public:
   std::string intrinsics;
 };
 
+/* Writes out a precompiled header instead, with the same intrinsics */
+class esbmc_pch_action : public clang::GeneratePCHAction
+{
+public:
+  esbmc_pch_action(const std::string &esbmc_instrinsics)
+    : intrinsics(esbmc_instrinsics){};
+
+  bool BeginSourceFileAction(clang::CompilerInstance &CI) override
+  {
+    if (!clang::GeneratePCHAction::BeginSourceFileAction(CI))
+      return false;
+
+    clang::Preprocessor &PP = CI.getPreprocessor();
+
+    std::string s = PP.getPredefines();
+    s += intrinsics;
+    PP.setPredefines(s);
+
+    return true;
+  }
+
+  std::string intrinsics;
+};
+
 #endif /* CLANG_C_FRONTEND_AST_ESBMC_ACTION_H_ */
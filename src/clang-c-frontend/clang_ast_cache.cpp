@@ -0,0 +1,257 @@
+#include <util/compiler_defs.h>
+CC_DIAGNOSTIC_PUSH()
+CC_DIAGNOSTIC_IGNORE_LLVM_CHECKS()
+#include <clang/Basic/LangOptions.h>
+#include <clang/Basic/Version.h>
+#include <clang/Frontend/ASTUnit.h>
+#include <clang/Lex/Lexer.h>
+#include <llvm/Support/raw_ostream.h>
+CC_DIAGNOSTIC_POP()
+
+#include <ac_config.h>
+#include <AST/build_ast.h>
+#include <boost/filesystem.hpp>
+#include <clang-c-frontend/clang_ast_cache.h>
+#include <fstream>
+#include <util/content_hash.h>
+#include <util/message.h>
+
+/* Splits a Makefile-style dependency list as written by clang. */
+static std::vector<std::string> parse_dependency_file(const std::string &s)
+{
+  std::vector<std::string> deps;
+  std::string cur;
+
+  size_t i = s.find(':');
+  if (i == std::string::npos)
+    return deps;
+
+  for (i++; i < s.size(); i++)
+  {
+    char c = s[i];
+    if (c == '\\' && i + 1 < s.size())
+    {
+      char n = s[i + 1];
+      if (n == '\n' || n == '\r')
+        c = ' ';
+      else if (n == ' ' || n == '#' || n == '\\')
+      {
+        cur += n;
+        i++;
+        continue;
+      }
+    }
+    else if (c == '$' && i + 1 < s.size() && s[i + 1] == '$')
+      i++;
+
+    if (isspace(static_cast<unsigned char>(c)))
+    {
+      if (!cur.empty())
+        deps.push_back(std::move(cur));
+      cur.clear();
+    }
+    else
+      cur += c;
+  }
+
+  if (!cur.empty())
+    deps.push_back(std::move(cur));
+  return deps;
+}
+
+static std::string cache_key(
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files,
+  const std::string &preamble)
+{
+  using content_hash::hash_string;
+
+  crypto_hash h;
+  hash_string(h, ESBMC_VERSION);
+  hash_string(h, clang::getClangFullVersion());
+  for (const std::string &arg : compiler_args)
+    hash_string(h, arg);
+  hash_string(h, intrinsics);
+  for (const file_operations::virtual_filest *files : virtual_files)
+    for (const auto &[path, contents] : *files)
+    {
+      hash_string(h, path);
+      hash_string(h, contents);
+    }
+  hash_string(h, preamble);
+  h.fin();
+  return h.to_string();
+}
+
+/* Returns the precompiled header of `preamble` cached under `key`, building
+ * it with `args` if it is missing or one of the files it includes changed.
+ * Returns an empty string on failure.
+ *
+ * The file `key` names the generation of the entry to use. A generation is
+ * never modified once named and `key` is only ever replaced by a rename, so
+ * the processes and threads sharing the cache always find a complete one.
+ * Superseded generations are left for the users that may still read them;
+ * removing the cache directory reclaims them. */
+static std::string cached_pch(
+  const std::string &key,
+  const std::string &intrinsics,
+  const std::vector<std::string> &args,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files,
+  const std::string &preamble)
+{
+  namespace fs = boost::filesystem;
+
+  fs::path dir = fs::path(key).parent_path();
+  std::string generation;
+  if (!content_hash::read_file(key, generation) && !generation.empty())
+  {
+    std::string base = (dir / generation).string();
+    if (
+      fs::exists(base + ".pch") &&
+      content_hash::dependencies_unchanged(base + ".deps"))
+    {
+      log_debug("clang", "reusing cached header {}.pch", base);
+      return base + ".pch";
+    }
+  }
+
+  boost::system::error_code ec;
+  fs::create_directories(dir, ec);
+
+  std::string base = fs::unique_path(key + "-%%%%-%%%%").string();
+  std::ofstream header(base + ".h");
+  header << preamble;
+  header.close();
+
+  std::vector<std::string> header_args = args;
+  header_args.push_back(base + ".h");
+
+  std::string deps;
+  bool ok =
+    header &&
+    !buildPCH(
+      intrinsics, header_args, virtual_files, base + ".pch", base + ".d") &&
+    !content_hash::read_file(base + ".d", deps);
+
+  if (ok)
+  {
+    std::ofstream out(base + ".deps");
+    for (const std::string &dep : parse_dependency_file(deps))
+    {
+      // The bundled headers are already part of the key
+      if (dep.rfind(file_operations::virtual_root(), 0) == 0)
+        continue;
+      if (content_hash::write_dependency(out, dep))
+      {
+        ok = false;
+        break;
+      }
+    }
+    out.close();
+    ok = ok && out;
+  }
+  fs::remove(base + ".d", ec);
+
+  if (ok)
+  {
+    // Publish the generation, replacing any stale one in a single rename
+    std::string tmp = fs::unique_path(key + "-%%%%-%%%%.name").string();
+    std::ofstream name(tmp);
+    name << fs::path(base).filename().string();
+    name.close();
+    if (name)
+      fs::rename(tmp, key, ec);
+    if (name && !ec)
+      return base + ".pch";
+    fs::remove(tmp, ec);
+  }
+
+  log_warning("failed to update the clang AST cache");
+  for (const char *ext : {".h", ".deps", ".pch"})
+    fs::remove(base + ext, ec);
+  return "";
+}
+
+std::unique_ptr<clang::ASTUnit> build_cached_ast(
+  const std::string &cache_dir,
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files,
+  std::string *diagnostics)
+{
+  namespace fs = boost::filesystem;
+
+  // The input file is the last argument, see clang_c_languaget::parse_files()
+  const std::string &path = compiler_args.back();
+  std::string input;
+  if (content_hash::read_file(path, input))
+    return buildASTs(intrinsics, compiler_args, virtual_files, "", diagnostics);
+
+  // The directives the input starts with, usually its #includes
+  clang::PreambleBounds bounds =
+    clang::Lexer::ComputePreamble(input, clang::LangOptions());
+  if (bounds.Size == 0)
+    return buildASTs(intrinsics, compiler_args, virtual_files, "", diagnostics);
+
+  std::string preamble = input.substr(0, bounds.Size);
+  if (!bounds.PreambleEndsAtStartOfLine)
+    preamble += '\n';
+
+  /* The header is compiled from the cache directory, so look up the quoted
+   * includes next to the input, too. The input itself is not part of the
+   * key, which lets the inputs of a directory that start alike share it. */
+  std::vector<std::string> args(compiler_args.begin(), compiler_args.end() - 1);
+  args.push_back("-iquote");
+  args.push_back(fs::absolute(path).parent_path().string());
+
+  std::string key = (fs::absolute(cache_dir) /
+                     cache_key(intrinsics, args, virtual_files, preamble))
+                      .string();
+  std::string pch = cached_pch(key, intrinsics, args, virtual_files, preamble);
+  if (!pch.empty())
+  {
+    /* Parse the rest of the input on top of the header, which already holds
+     * the intrinsics. The preamble is blanked out rather than removed, to
+     * keep the locations. */
+    std::string rest = input;
+    for (size_t i = 0; i < bounds.Size; i++)
+      if (rest[i] != '\n' && rest[i] != '\r')
+        rest[i] = ' ';
+
+    file_operations::virtual_filest main_file = {{path, rest}};
+    std::vector<const file_operations::virtual_filest *> files = virtual_files;
+    files.push_back(&main_file);
+
+    args.push_back("-include-pch");
+    args.push_back(pch);
+    args.push_back(path);
+
+    std::string pch_diagnostics;
+    std::unique_ptr<clang::ASTUnit> unit =
+      buildASTs("", args, files, "", &pch_diagnostics);
+    if (!unit->getDiagnostics().hasErrorOccurred())
+    {
+      if (diagnostics)
+        *diagnostics += pch_diagnostics;
+      else
+        llvm::errs() << pch_diagnostics;
+      return unit;
+    }
+
+    log_debug("clang", "not using cached header {}", pch);
+  }
+
+  std::unique_ptr<clang::ASTUnit> unit =
+    buildASTs(intrinsics, compiler_args, virtual_files, "", diagnostics);
+
+  /* Clang rejects a header whose includes were touched since it was built.
+   * If only the header was at fault, drop it so that it is built again. */
+  if (!pch.empty() && !unit->getDiagnostics().hasErrorOccurred())
+  {
+    boost::system::error_code ec;
+    fs::remove(key, ec);
+  }
+
+  return unit;
+}
@@ -0,0 +1,29 @@
+#ifndef CLANG_C_FRONTEND_CLANG_AST_CACHE_H_
+#define CLANG_C_FRONTEND_CLANG_AST_CACHE_H_
+
+#include <memory>
+#include <string>
+#include <util/filesystem.h>
+#include <vector>
+
+// Forward dec, to avoid bringing in clang headers
+namespace clang
+{
+class ASTUnit;
+} // namespace clang
+
+/* Like buildASTs(), but parses the directives the input starts with, usually
+ * its #includes, into a precompiled header cached in `cache_dir` and shared
+ * with later runs and with other inputs that start alike. Headers are keyed
+ * by the ESBMC and Clang versions, the compiler arguments other than the
+ * input, the directory of the input, the intrinsics, the bundled headers and
+ * the text of the directives, and are only reused while none of the files
+ * they include have changed. */
+std::unique_ptr<clang::ASTUnit> build_cached_ast(
+  const std::string &cache_dir,
+  const std::string &intrinsics,
+  const std::vector<std::string> &compiler_args,
+  const std::vector<const file_operations::virtual_filest *> &virtual_files,
+  std::string *diagnostics = nullptr);
+
+#endif /* CLANG_C_FRONTEND_CLANG_AST_CACHE_H_ */
@@ -8,12 +8,16 @@ CC_DIAGNOSTIC_POP()
 #include <ansi-c/c_preprocess.h>
 #include <boost/filesystem.hpp>
 #include <c2goto/cprover_library.h>
+#include <clang-c-frontend/clang_ast_cache.h>
 #include <clang-c-frontend/clang_c_adjust.h>
 #include <clang-c-frontend/clang_c_convert.h>
 #include <clang-c-frontend/clang_c_language.h>
 #include <clang-c-frontend/clang_c_main.h>
 #include <util/c_expr2string.h>
+#include <atomic>
+#include <future>
 #include <sstream>
+#include <thread>
 #include <util/c_link.h>
 
 #include <util/filesystem.h>
@@ -44,10 +48,12 @@ void clang_c_languaget::build_include_args(
   {
     compiler_args.push_back("-isystem");
     compiler_args.push_back(*libc_headers);
+    virtual_files.push_back(&internal_libc_header_files());
   }
 
   compiler_args.push_back("-resource-dir");
   compiler_args.push_back(clang_resource_dir());
+  virtual_files.push_back(&clang_resource_files());
 
   for (const auto &dir : config.ansi_c.idirafter_paths)
   {
@@ -280,31 +286,108 @@ void clang_c_languaget::force_file_type(std::vector<std::string> &compiler_args)
 }
 
 bool clang_c_languaget::parse(const std::string &path)
+{
+  return clang_c_languaget::parse_files({path});
+}
+
+/* Number of translation units to build at once; --frontend-jobs, or one per
+ * hardware thread by default. */
+static unsigned frontend_jobs()
+{
+  const std::string jobs = config.options.get_option("frontend-jobs");
+  if (!jobs.empty())
+    return std::max(1, atoi(jobs.c_str()));
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+bool clang_c_languaget::parse_files(const std::vector<std::string> &paths)
 {
   // preprocessing
 
-  std::ostringstream o_preprocessed;
-  if (preprocess(path, o_preprocessed))
-    return true;
+  for (const std::string &path : paths)
+  {
+    std::ostringstream o_preprocessed;
+    if (preprocess(path, o_preprocessed))
+      return true;
+  }
 
-  // Get compiler arguments and add the file path
-  std::vector<std::string> new_compiler_args = compiler_args("clang-tool");
-  new_compiler_args.push_back(path);
+  // Get compiler arguments; the file path is added per file
+  const std::vector<std::string> args = compiler_args("clang-tool");
 
   if (FILE *f = messaget::state.target("clang", VerbosityLevel::Debug))
   {
-    fprintf(f, "clang invocation:");
-    for (const std::string &s : new_compiler_args)
-      fprintf(f, " '%s'", s.c_str());
-    fprintf(f, "\n");
+    for (const std::string &path : paths)
+    {
+      fprintf(f, "clang invocation:");
+      for (const std::string &s : args)
+        fprintf(f, " '%s'", s.c_str());
+      fprintf(f, " '%s'\n", path.c_str());
+    }
   }
 
   // Get intrinsics
-  std::string intrinsics = internal_additions();
+  const std::string intrinsics = internal_additions();
+
+  const std::string cache_dir = config.options.get_option("clang-ast-cache");
+  auto build = [&](const std::string &path, std::string *diagnostics) {
+    std::vector<std::string> new_compiler_args = args;
+    new_compiler_args.push_back(path);
+    return cache_dir.empty()
+             ? buildASTs(
+                 intrinsics, new_compiler_args, virtual_files, "", diagnostics)
+             : build_cached_ast(
+                 cache_dir,
+                 intrinsics,
+                 new_compiler_args,
+                 virtual_files,
+                 diagnostics);
+  };
+
+  unsigned jobs = std::min<size_t>(paths.size(), frontend_jobs());
+  if (jobs <= 1)
+  {
+    for (const std::string &path : paths)
+      if (merge_ast(build(path, nullptr)))
+        return true;
+    return false;
+  }
 
-  // Generate ASTUnit and add to our vector
-  auto newAST = buildASTs(intrinsics, new_compiler_args);
+  /* Build the ASTUnits on a pool of threads, but merge them here in the order
+   * of `paths`, so that the result does not depend on the scheduling. The
+   * diagnostics are buffered and printed in that order, too. */
+  typedef std::pair<std::unique_ptr<clang::ASTUnit>, std::string> resultt;
+  std::vector<std::promise<resultt>> promises(paths.size());
+  std::atomic<size_t> next{0};
+  std::atomic<bool> stop{false};
+
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < jobs; i++)
+    workers.emplace_back([&]() {
+      for (size_t j; !stop && (j = next++) < paths.size();)
+      {
+        resultt r;
+        r.first = build(paths[j], &r.second);
+        promises[j].set_value(std::move(r));
+      }
+    });
 
+  bool error = false;
+  for (size_t j = 0; j < paths.size() && !error; j++)
+  {
+    resultt r = promises[j].get_future().get();
+    llvm::errs() << r.second;
+    error = merge_ast(std::move(r.first));
+  }
+
+  stop = true;
+  for (std::thread &t : workers)
+    t.join();
+
+  return error;
+}
+
+bool clang_c_languaget::merge_ast(std::unique_ptr<clang::ASTUnit> newAST)
+{
   // Use diagnostics to find errors, rather than the return code.
   if (newAST->getDiagnostics().hasErrorOccurred())
     return true;
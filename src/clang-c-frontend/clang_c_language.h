@@ -1,6 +1,7 @@
 #ifndef CLANG_C_FRONTEND_CLANG_C_LANGUAGE_H_
 #define CLANG_C_FRONTEND_CLANG_C_LANGUAGE_H_
 
+#include <util/filesystem.h>
 #include <util/language.h>
 
 #define __STDC_LIMIT_MACROS
@@ -19,6 +20,9 @@ public:
 
   bool parse(const std::string &path) override;
 
+  // builds the ASTs of several files concurrently, see --frontend-jobs
+  bool parse_files(const std::vector<std::string> &paths) override;
+
   bool final(contextt &context) override;
 
   bool typecheck(contextt &context, const std::string &module) override;
@@ -57,6 +61,8 @@ protected:
   virtual std::string internal_additions();
 
   static const std::string &clang_resource_dir();
+  /* The bundled Clang headers below clang_resource_dir(), if any */
+  static const file_operations::virtual_filest &clang_resource_files();
 
   // Force the file type, .c for the C frontend and .cpp for the C++ one
   virtual void force_file_type(std::vector<std::string> &compiler_args);
@@ -87,12 +93,17 @@ protected:
    * per '-nostdinc'; 8 is done via '-idirafter'.
    *
    * Note: built-in paths are subject to --sysroot.
+   *
+   * Bundled headers (2, 3, 4 and possibly 6) are not extracted to disk; their
+   * directories are virtual and the files are collected in `virtual_files`
+   * for buildASTs() to serve from memory.
    */
   virtual void build_include_args(std::vector<std::string> &compiler_args);
   virtual void build_compiler_args(std::vector<std::string> &compiler_args);
 
   std::vector<std::string> compiler_args(std::string tool_name)
   {
+    virtual_files.clear();
     std::vector<std::string> v{std::move(tool_name)};
     force_file_type(v);
     build_include_args(v);
@@ -100,6 +111,11 @@ protected:
     return v;
   }
 
+  std::vector<const file_operations::virtual_filest *> virtual_files;
+
+  // merges a freshly built translation unit into AST; true on errors in it
+  bool merge_ast(std::unique_ptr<clang::ASTUnit> newAST);
+
   std::unique_ptr<clang::ASTUnit> AST;
 };
 
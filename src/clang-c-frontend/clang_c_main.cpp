@@ -65,23 +65,23 @@ bool clang_c_maint::clang_main()
   // find main symbol
   std::list<irep_idt> matches;
 
-  forall_symbol_base_map (it, context.symbol_base_map, main)
+  forall_symbol_base_map (id, context.symbol_base_map, main)
   {
     // if user provided class/contract name
     if (!config.cname.empty() && !config.main.empty())
     {
       const std::string fmt = "@" + config.cname + "@F@" + main;
-      if (it->second.as_string().find(fmt) == std::string::npos)
+      if (id.as_string().find(fmt) == std::string::npos)
         continue;
     }
     // look it up
-    symbolt *s = context.find_symbol(it->second);
+    symbolt *s = context.find_symbol(id);
 
     if (s == nullptr)
       continue;
 
     if (s->type.is_code())
-      matches.push_back(it->second);
+      matches.push_back(id);
   }
 
   if (matches.empty())
@@ -45,7 +45,8 @@ void clang_cpp_languaget::build_include_args(
 
   if (do_inc)
   {
-    cppinc = esbmct::abstract_cpp_includes();
+    cppinc = esbmct::abstract_cpp_include_dir();
+    virtual_files.push_back(&esbmct::abstract_cpp_include_files());
     log_debug("c++", "Adding CPP includes: {}", cppinc);
     // Let the cpp include "overtake" others.
     compiler_args.push_back("-isystem");
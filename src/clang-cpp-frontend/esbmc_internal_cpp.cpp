@@ -26,4 +26,24 @@ const std::string &esbmct::abstract_cpp_includes()
 #undef ESBMC_FLAIL
   }
   return p.path();
-}
\ No newline at end of file
+}
+
+const std::string &esbmct::abstract_cpp_include_dir()
+{
+  static const std::string path = file_operations::virtual_root() + "/cpp";
+  return path;
+}
+
+const file_operations::virtual_filest &esbmct::abstract_cpp_include_files()
+{
+  static const file_operations::virtual_filest files = [] {
+    file_operations::virtual_filest v;
+    const std::string &path = abstract_cpp_include_dir();
+#define ESBMC_FLAIL(body, size, ...)                                           \
+  v.emplace_back(path + "/" #__VA_ARGS__, std::string(body, size));
+#include <abstract_includes/cpp_includes.h>
+#undef ESBMC_FLAIL
+    return v;
+  }();
+  return files;
+}
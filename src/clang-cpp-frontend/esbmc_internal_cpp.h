@@ -1,5 +1,12 @@
 #include <sstream>
+#include <util/filesystem.h>
 namespace esbmct
 {
+/* Extracts the C++ library headers to disk, for external preprocessors */
 const std::string &abstract_cpp_includes();
+
+/* The virtual directory holding the C++ library headers and their contents,
+ * served from memory to the clang frontend */
+const std::string &abstract_cpp_include_dir();
+const file_operations::virtual_filest &abstract_cpp_include_files();
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #ifndef _WIN32
 #  include <unistd.h>
 #  include <sched.h>
+#  include <sys/wait.h>
 #else
 #  include <windows.h>
 #  include <winbase.h>
@@ -34,6 +35,7 @@
 #include <util/i2string.h>
 #include <irep2/irep2.h>
 #include <util/location.h>
+#include <util/prefix.h>
 
 #include <util/migrate.h>
 #include <util/show_symbol_table.h>
@@ -47,6 +49,7 @@ bmct::bmct(goto_functionst &funcs, optionst &opts, contextt &_context)
 {
   interleaving_number = 0;
   interleaving_failed = 0;
+  interleaving_foreign = 0;
 
   ltl_results_seen[ltl_res_bad] = 0;
   ltl_results_seen[ltl_res_failing] = 0;
@@ -92,6 +95,13 @@ bmct::bmct(goto_functionst &funcs, optionst &opts, contextt &_context)
   }
 }
 
+bmct::~bmct()
+{
+  // The next run goes on from the formula in the solver
+  if (incremental && runtime_solver)
+    incremental->give_back(std::move(runtime_solver));
+}
+
 void bmct::successful_trace()
 {
   if (options.get_bool_option("result-only"))
@@ -170,7 +180,10 @@ void bmct::generate_smt_from_equation(
   log_status("Encoding remaining VCC(s) using {}", logic);
 
   fine_timet encode_start = current_time();
-  eq.convert(smt_conv);
+  if (incremental)
+    incremental->convert(smt_conv, eq);
+  else
+    eq.convert(smt_conv);
   fine_timet encode_stop = current_time();
   log_status(
     "Encoding to solver time: {}s", time2string(encode_stop - encode_start));
@@ -458,6 +471,33 @@ void bmct::report_result(smt_convt::resultt &res)
 
 smt_convt::resultt bmct::start_bmc()
 {
+#ifndef _WIN32
+  unsigned workers =
+    atoi(options.get_option("parallel-interleavings").c_str());
+  if (
+    workers > 1 &&
+    (options.get_bool_option("schedule") || options.get_bool_option("ltl") ||
+     options.get_bool_option("state-hashing") ||
+     options.get_bool_option("interactive-ileaves") ||
+     options.get_bool_option("smt-during-symex") ||
+     options.get_bool_option("multi-property")))
+  {
+    // These either explore a single formula or depend on state shared
+    // between interleavings, which the workers cannot see.
+    log_warning(
+      "--parallel-interleavings is not supported with the selected options, "
+      "exploring interleavings sequentially");
+    workers = 1;
+  }
+
+  if (workers > 1)
+  {
+    smt_convt::resultt res = run_parallel_interleavings(workers);
+    report_result(res);
+    return res;
+  }
+#endif
+
   std::shared_ptr<symex_target_equationt> eq;
   smt_convt::resultt res = run(eq);
   if (!options.get_bool_option("multi-property"))
@@ -491,6 +531,9 @@ smt_convt::resultt bmct::run(std::shared_ptr<symex_target_equationt> &eq)
 
       if (config.options.get_bool_option("bidirectional"))
         bidirectional_search(*runtime_solver, *eq);
+
+      if (options.get_bool_option("forward-condition"))
+        collect_failed_unwindings(*runtime_solver, *eq);
     }
 
     if (res)
@@ -529,6 +572,130 @@ smt_convt::resultt bmct::run(std::shared_ptr<symex_target_equationt> &eq)
   return interleaving_failed > 0 ? smt_convt::P_SATISFIABLE : res;
 }
 
+#ifndef _WIN32
+smt_convt::resultt bmct::run_parallel_interleavings(unsigned workers)
+{
+  // Message sent by each worker back to the parent.
+  struct worker_resultt
+  {
+    smt_convt::resultt res;
+    uint64_t interleavings;
+    uint64_t failed;
+  };
+
+  unsigned depth =
+    atoi(options.get_option("interleaving-split-depth").c_str());
+  if (depth == 0)
+    depth = 3;
+
+  int result_pipe[2];
+  if (pipe(result_pipe))
+  {
+    log_error("Pipe creation failed, giving up.");
+    abort();
+  }
+
+  // Buffered output would otherwise be printed by the parent and by every
+  // worker, e.g., when stdout is a pipe.
+  fflush(stdout);
+  fflush(stderr);
+
+  std::vector<pid_t> children;
+  for (unsigned w = 0; w < workers; ++w)
+  {
+    pid_t pid = fork();
+    if (pid == -1)
+    {
+      log_error("Fork failed, giving up.");
+      abort();
+    }
+
+    if (pid)
+    {
+      children.push_back(pid);
+      continue;
+    }
+
+    // Worker: explore our share of the reachability tree, print the
+    // counterexample ourselves (we own the equation) and report back.
+    close(result_pipe[0]);
+    symex->set_partition(w, workers, depth);
+
+    std::shared_ptr<symex_target_equationt> eq;
+    smt_convt::resultt res = run(eq);
+    if (eq && res == smt_convt::P_SATISFIABLE)
+      report_trace(res, *eq);
+
+    // The shared interleavings above the split depth are generated by every
+    // worker, only report the ones we checked.
+    BigInt checked = interleaving_number - interleaving_foreign;
+    worker_resultt r = {
+      res, checked.to_uint64(), interleaving_failed.to_uint64()};
+
+    // _exit skips the stdio buffers; the trace must be out before the
+    // parent learns of the result and kills us.
+    fflush(stdout);
+    fflush(stderr);
+    auto const len = write(result_pipe[1], &r, sizeof(r));
+    assert(len == sizeof(r) && "short write");
+    (void)len; //ndebug
+    _exit(0);
+  }
+
+  close(result_pipe[1]);
+  log_status(
+    "Exploring thread interleavings with {} workers, split at depth {}",
+    workers,
+    depth);
+
+  bool all_runs = options.get_bool_option("all-runs");
+  smt_convt::resultt res = smt_convt::P_UNSATISFIABLE;
+  unsigned finished = 0;
+  while (finished < workers)
+  {
+    worker_resultt r;
+    int read_size = read(result_pipe[0], &r, sizeof(r));
+    if (read_size == 0)
+      break; // All workers hung up, some of them without reporting.
+
+    if (read_size != sizeof(r))
+    {
+      log_error("Short read communicating with interleaving workers");
+      abort();
+    }
+
+    ++finished;
+    interleaving_number += r.interleavings;
+    interleaving_failed += r.failed;
+
+    if (r.res == smt_convt::P_SATISFIABLE)
+    {
+      res = r.res;
+      // A bug was found: nobody else needs to keep looking.
+      if (!all_runs)
+        break;
+    }
+    else if (
+      r.res != smt_convt::P_UNSATISFIABLE && res != smt_convt::P_SATISFIABLE)
+      res = r.res;
+  }
+
+  if (finished < workers && res != smt_convt::P_SATISFIABLE)
+  {
+    log_error("Interleaving worker terminated without reporting a result");
+    res = smt_convt::P_ERROR;
+  }
+
+  for (pid_t pid : children)
+    kill(pid, SIGKILL);
+  for (pid_t pid : children)
+    waitpid(pid, nullptr, 0);
+  close(result_pipe[0]);
+
+  return res;
+}
+#endif
+
 void bmct::bidirectional_search(
   smt_convt &smt_conv,
   const symex_target_equationt &eq)
@@ -565,25 +732,11 @@ void bmct::bidirectional_search(
       symex->goto_functions.function_map.find(f.function);
     assert(fit != symex->goto_functions.function_map.end());
 
-    // Find function loops
-    goto_loopst loops(f.function, symex->goto_functions, fit->second);
-
-    if (!loops.get_loops().size())
-      continue;
-
-    auto lit = loops.get_loops().begin(), lie = loops.get_loops().end();
-    while (lit != lie)
-    {
-      auto loop_head = lit->get_original_loop_head();
-
-      // Skip constraints from other loops
-      if (loop_head->loop_number == assert_loop_number)
-        break;
-
-      ++lit;
-    }
-
-    if (lit == lie)
+    // Find the loop of the assertion, constraints from other loops are
+    // skipped
+    const loopst *lit = symex->goto_functions.get_function_loops(fit).get_loop(
+      assert_loop_number);
+    if (!lit)
       continue;
 
     // Get the loop vars
@@ -658,6 +811,106 @@ void bmct::bidirectional_search(
   }
 }
 
+void bmct::collect_failed_unwindings(
+  smt_convt &smt_conv,
+  const symex_target_equationt &eq)
+{
+  // The forward condition only checks unwinding assertions, a model may
+  // violate several of them at once
+  for (const auto &step : eq.SSA_steps)
+  {
+    if (
+      !step.ignore && step.is_assert() &&
+      has_prefix(step.comment, "unwinding assertion loop ") &&
+      smt_conv.l_get(step.cond_ast).is_false())
+      failed_unwinding_loops.insert(step.source.pc->loop_number);
+  }
+}
+
+/// Whether the two steps are encoded the same way
+static bool same_encoding(
+  const symex_target_equationt::SSA_stept &a,
+  const symex_target_equationt::SSA_stept &b)
+{
+  return a.type == b.type && a.ignore == b.ignore && a.guard == b.guard &&
+         a.cond == b.cond && a.lhs == b.lhs && a.rhs == b.rhs &&
+         a.output_args == b.output_args;
+}
+
+std::unique_ptr<smt_convt> incremental_formulat::take(
+  const symex_target_equationt &eq,
+  const optionst &options)
+{
+  // Drop what was only in the last formula
+  if (pushed)
+  {
+    solver->pop_ctx();
+    pushed = false;
+  }
+
+  shared = 0;
+  auto prev = steps.begin();
+  for (auto it = eq.SSA_steps.begin();
+       it != eq.SSA_steps.end() && prev != steps.end() &&
+       same_encoding(*it, *prev);
+       ++it, ++prev)
+    ++shared;
+
+  // Part of the formula outside of the context changed, start again
+  if (!solver || shared < kept)
+  {
+    solver.reset(create_solver("", ns, options));
+    kept = 0;
+    assertions.clear();
+    assumptions = solver->convert_ast(gen_true_expr());
+  }
+
+  return std::move(solver);
+}
+
+void incremental_formulat::give_back(std::unique_ptr<smt_convt> s)
+{
+  solver = std::move(s);
+}
+
+void incremental_formulat::convert(
+  smt_convt &smt_conv,
+  symex_target_equationt &eq)
+{
+  auto it = eq.SSA_steps.begin();
+  auto prev = steps.begin();
+  std::size_t i = 0;
+
+  // These are in the solver already
+  for (; i < kept; ++i, ++it, ++prev)
+  {
+    it->guard_ast = prev->guard_ast;
+    it->cond_ast = prev->cond_ast;
+    it->converted_output_args = prev->converted_output_args;
+  }
+
+  // The next run is likely to share these as well, encode them for good
+  for (; i < shared; ++i, ++it)
+    eq.convert_internal_step(smt_conv, assumptions, assertions, *it);
+  kept = shared;
+
+  log_status(
+    "Reusing the encoding of {} SSA step(s) from the previous run", kept);
+
+  smt_conv.push_ctx();
+  pushed = true;
+
+  smt_astt assumpt_ast = assumptions;
+  smt_convt::ast_vec all_assertions = assertions;
+  for (; it != eq.SSA_steps.end(); ++it)
+    eq.convert_internal_step(smt_conv, assumpt_ast, all_assertions, *it);
+
+  if (!all_assertions.empty())
+    smt_conv.assert_ast(smt_conv.make_n_ary_or(all_assertions));
+
+  steps = eq.SSA_steps;
+}
+
 smt_convt::resultt bmct::run_thread(std::shared_ptr<symex_target_equationt> &eq)
 {
   fine_timet symex_start = current_time();
@@ -677,6 +930,13 @@ smt_convt::resultt bmct::run_thread(std::shared_ptr<symex_target_equationt> &eq)
       time2string(symex_stop - symex_start),
       eq->SSA_steps.size());
 
+    // Another interleaving worker is responsible for this trace.
+    if (!symex->owns_current_formula())
+    {
+      ++interleaving_foreign;
+      return smt_convt::P_UNSATISFIABLE;
+    }
+
     if (options.get_bool_option("double-assign-check"))
       eq->check_for_duplicate_assigns();
 
@@ -741,7 +1001,23 @@ smt_convt::resultt bmct::run_thread(std::shared_ptr<symex_target_equationt> &eq)
       return smt_convt::P_UNSATISFIABLE;
     }
 
-    if (!options.get_bool_option("smt-during-symex"))
+    // The formula is dumped or checked in parts when it is kept in the
+    // solver, do it from scratch then. With --smt-during-symex it already
+    // is in the solver symex used.
+    if (
+      incremental && (options.get_bool_option("smt-formula-too") ||
+                      options.get_bool_option("smt-formula-only") ||
+                      options.get_bool_option("multi-property") ||
+                      options.get_bool_option("smt-during-symex")))
+      incremental = nullptr;
+
+    if (incremental)
+    {
+      if (runtime_solver)
+        incremental->give_back(std::move(runtime_solver));
+      runtime_solver = incremental->take(*eq, options);
+    }
+    else if (!options.get_bool_option("smt-during-symex"))
     {
       runtime_solver =
         std::unique_ptr<smt_convt>(create_solver("", ns, options));
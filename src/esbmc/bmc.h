@@ -7,6 +7,7 @@
 #include <langapi/language_ui.h>
 #include <list>
 #include <map>
+#include <set>
 #include <solvers/smt/smt_conv.h>
 #include <solvers/smtlib/smtlib_conv.h>
 #include <solvers/solve.h>
@@ -15,6 +16,48 @@
 #include <util/cmdline.h>
 #include <atomic>
 
+/**
+ * The formula of the last run of a sequence of related runs, e.g. the
+ * inductive step for increasing k, kept in one solver across the runs.
+ * The SSA steps a run shares with the previous one are encoded outside of
+ * the solver context holding the rest of the formula, so they are only
+ * encoded once.
+ */
+class incremental_formulat
+{
+public:
+  explicit incremental_formulat(const contextt &context) : ns(context)
+  {
+  }
+
+  /**
+   *  Returns the solver to encode eq with, which keeps the steps eq shares
+   *  with the last equation. Hand it back through give_back() once the
+   *  result of the run has been reported.
+   */
+  std::unique_ptr<smt_convt>
+  take(const symex_target_equationt &eq, const optionst &options);
+  void give_back(std::unique_ptr<smt_convt> solver);
+
+  /// Encodes the steps of eq that the solver from take() does not hold yet
+  void convert(smt_convt &smt_conv, symex_target_equationt &eq);
+
+protected:
+  namespacet ns;
+  std::unique_ptr<smt_convt> solver;
+
+  // the steps of the last equation, the first kept of which (and their
+  // assumptions and assertions) are encoded outside of the solver context
+  symex_target_equationt::SSA_stepst steps;
+  std::size_t kept = 0;
+  smt_astt assumptions = nullptr;
+  smt_convt::ast_vec assertions;
+
+  // how many steps of the equation being encoded are the same as in steps
+  std::size_t shared = 0;
+  bool pushed = false;
+};
+
 class bmct
 {
 public:
@@ -32,10 +75,23 @@ public:
 
   BigInt interleaving_number;
   BigInt interleaving_failed;
+  /** Interleavings generated but left to another worker to check, see
+   *  run_parallel_interleavings */
+  BigInt interleaving_foreign;
+
+  /// Loops whose unwinding assertion is violated by the counterexample of
+  /// the last forward condition
+  std::set<unsigned> failed_unwinding_loops;
 
   virtual smt_convt::resultt start_bmc();
   virtual smt_convt::resultt run(std::shared_ptr<symex_target_equationt> &eq);
-  virtual ~bmct() = default;
+  virtual ~bmct();
+
+  /// Keep the formula in f across runs, see incremental_formulat
+  void set_incremental_formula(incremental_formulat &f)
+  {
+    incremental = &f;
+  }
 
 protected:
   const contextt &context;
@@ -43,6 +99,7 @@ protected:
 
   std::unique_ptr<smt_convt> runtime_solver;
   std::unique_ptr<reachability_treet> symex;
+  incremental_formulat *incremental = nullptr;
   mutable std::atomic<bool> keep_alive_running;
   mutable std::atomic<int> keep_alive_interval;
 
@@ -79,8 +136,23 @@ protected:
   virtual void
   bidirectional_search(smt_convt &smt_conv, const symex_target_equationt &eq);
 
+  void collect_failed_unwindings(
+    smt_convt &smt_conv,
+    const symex_target_equationt &eq);
+
   smt_convt::resultt run_thread(std::shared_ptr<symex_target_equationt> &eq);
 
+  /**
+   *  Explore the thread interleavings from several worker processes, each
+   *  taking a share of the reachability tree (see
+   *  reachability_treet::set_partition). Workers print their own
+   *  counterexamples; the first one to find a bug stops the others unless
+   *  --all-runs is given.
+   *  @param workers Number of worker processes to fork.
+   *  @return Combined verification result.
+   */
+  smt_convt::resultt run_parallel_interleavings(unsigned workers);
+
   int ltl_run_thread(symex_target_equationt &equation) const;
 
   smt_convt::resultt multi_property_check(
@@ -25,6 +25,10 @@ extern "C"
 #include <cstdlib>
 #include <util/expr_util.h>
 #include <iostream>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
 #include <goto-programs/add_race_assertions.h>
 #include <goto-programs/goto_check.h>
 #include <goto-programs/goto_convert_functions.h>
@@ -39,6 +43,7 @@ extern "C"
 #include <goto-programs/remove_unreachable.h>
 #include <goto-programs/set_claims.h>
 #include <goto-programs/show_claims.h>
+#include <goto-programs/loop_acceleration.h>
 #include <goto-programs/loop_unroll.h>
 #include <goto-programs/mark_decl_as_non_det.h>
 #include <goto-programs/assign_params_as_non_det.h>
@@ -553,6 +558,11 @@ int esbmc_parseoptionst::doit()
 
   // Initialize goto_functions algorithms
   {
+    // Loop acceleration, before the remaining bounded loops are unrolled
+    if (cmdline.isset("goto-accelerate"))
+      goto_preprocess_algorithms.push_back(
+        std::make_unique<loop_accelerator>());
+
     // Loop unrolling
     if (cmdline.isset("goto-unwind") && !cmdline.isset("unwind"))
     {
@@ -1237,6 +1247,12 @@ int esbmc_parseoptionst::do_bmc_strategy(
     abort();
   }
 
+  if (
+    options.get_bool_option("incremental-bmc") &&
+    options.get_bool_option("adaptive-unwind"))
+    return do_adaptive_unwind(
+      options, goto_functions, k_step_base, k_step_inc, max_k_step);
+
   // Trying all bounds from 1 to "max_k_step" in "k_step_inc"
   for (uint64_t k_step = k_step_base; k_step <= max_k_step;
        k_step += k_step_inc)
@@ -1298,6 +1314,104 @@ int esbmc_parseoptionst::do_bmc_strategy(
   return 0;
 }
 
+static std::map<unsigned, uint64_t> parse_unwindset(const std::string &set)
+{
+  std::map<unsigned, uint64_t> bounds;
+  std::istringstream in(set);
+  std::string val;
+  while (std::getline(in, val, ','))
+  {
+    std::string::size_type colon = val.find(':');
+    if (colon != std::string::npos)
+      bounds[atoi(val.substr(0, colon).c_str())] =
+        strtoull(val.substr(colon + 1).c_str(), nullptr, 10);
+  }
+  return bounds;
+}
+
+static std::string unwindset_string(const std::map<unsigned, uint64_t> &bounds)
+{
+  std::string set;
+  for (const auto &[loop, bound] : bounds)
+    set += (set.empty() ? "" : ",") + std::to_string(loop) + ":" +
+           std::to_string(bound);
+  return set;
+}
+
+// This is the incremental BMC strategy with a bound per loop: all the loops
+// start unwound "k_step_base" times (or as given by --unwindset, e.g. the
+// profile of a previous run) and only the loops whose unwinding assertions
+// fail in the forward condition are unwound "k_step_inc" more times, up to
+// "max_k_step". The final bounds are written to --unwindset-output so that
+// later runs can start from them.
+//
+// \param options - options for setting the verification strategy
+// and controlling symbolic execution
+// \param goto_functions - GOTO program under verification
+int esbmc_parseoptionst::do_adaptive_unwind(
+  optionst &options,
+  goto_functionst &goto_functions,
+  uint64_t k_step_base,
+  uint64_t k_step_inc,
+  uint64_t max_k_step)
+{
+  std::map<unsigned, uint64_t> bounds =
+    parse_unwindset(options.get_option("unwindset"));
+
+  auto save_profile = [&]() {
+    const std::string &filename = options.get_option("unwindset-output");
+    if (filename.empty())
+      return;
+
+    std::ofstream out(filename);
+    out << unwindset_string(bounds) << "\n";
+  };
+
+  for (;;)
+  {
+    options.set_option("unwindset", unwindset_string(bounds));
+    log_status("Unwinding loops with bounds {{{}}}", unwindset_string(bounds));
+
+    if (
+      is_base_case_violated(options, goto_functions, k_step_base).is_true() &&
+      !cmdline.isset("multi-property"))
+    {
+      save_profile();
+      return 1;
+    }
+
+    std::set<unsigned> failed_loops;
+    tvt res = does_forward_condition_hold(
+      options, goto_functions, k_step_base, &failed_loops);
+    if (res.is_false())
+    {
+      save_profile();
+      return 0;
+    }
+
+    // Deepen the loops that may still run after their bound, the others
+    // are already unwound enough
+    bool deepened = false;
+    for (unsigned loop : failed_loops)
+    {
+      uint64_t &bound = bounds.emplace(loop, k_step_base).first->second;
+      if (bound + k_step_inc > max_k_step)
+        continue;
+
+      bound += k_step_inc;
+      deepened = true;
+    }
+
+    if (!deepened)
+      break;
+  }
+
+  save_profile();
+  log_status("Unable to prove or falsify the program, giving up.");
+  log_fail("VERIFICATION UNKNOWN");
+  return 0;
+}
+
 // This checks whether "there is a set of inputs that reaches and violates
 // an assertion when all the loops in the verified program are unwound up to
 // the given bound k".
@@ -1362,7 +1476,8 @@ tvt esbmc_parseoptionst::is_base_case_violated(
 tvt esbmc_parseoptionst::does_forward_condition_hold(
   optionst &options,
   goto_functionst &goto_functions,
-  const uint64_t &k_step)
+  const uint64_t &k_step,
+  std::set<unsigned> *failed_loops)
 {
   if (options.get_bool_option("disable-forward-condition"))
     return tvt(tvt::TV_UNKNOWN);
@@ -1389,6 +1504,9 @@ tvt esbmc_parseoptionst::does_forward_condition_hold(
   // Restore the no assertion flag, before checking the other steps
   options.set_option("no-assertions", no_assertions);
 
+  if (failed_loops)
+    *failed_loops = bmc.failed_unwinding_loops;
+
   switch (res)
   {
   case smt_convt::P_SATISFIABLE:
@@ -1448,6 +1566,14 @@ tvt esbmc_parseoptionst::is_inductive_step_violated(
 
   bmct bmc(goto_functions, options, context);
 
+  // Only the steps of this k that differ from the last one are encoded
+  if (options.get_bool_option("incremental-inductive-step"))
+  {
+    if (!inductive_step_formula)
+      inductive_step_formula = std::make_unique<incremental_formulat>(context);
+    bmc.set_incremental_formula(*inductive_step_formula);
+  }
+
   log_progress("Checking inductive step, k = {:d}", k_step);
   switch (do_bmc(bmc))
   {
@@ -1780,36 +1906,47 @@ bool esbmc_parseoptionst::process_goto_program(
       // options.set_option("no-reachable-memory-leak", true);
     }
 
-    // Start by removing all no-op instructions and unreachable code
-    if (!(cmdline.isset("no-remove-no-op")))
-      remove_no_op(goto_functions);
+    /* The passes below are run in order by a pass manager, which sweeps
+     * over each function once for consecutive passes local to it. */
+    goto_function_passt no_op_pass(
+      [](goto_functiont &f) { remove_no_op(f.body); });
+    goto_function_passt unreachable_pass(
+      [](goto_functiont &f) { remove_unreachable(f); });
+    goto_function_pass_managert passes;
 
+    bool no_op = !cmdline.isset("no-remove-no-op");
     // We should skip this 'remove-unreachable' removal in goto-cov and multi-property
     // - multi-property wants to find all the bugs in the src code
     // - assertion-coverage wants to find out unreached codes (asserts)
     // - however, the optimization below will remove codes during the Goto stage
-    if (!(cmdline.isset("no-remove-unreachable") || is_mul || is_coverage))
-      remove_unreachable(goto_functions);
+    bool unreachable =
+      !(cmdline.isset("no-remove-unreachable") || is_mul || is_coverage);
+
+    // Start by removing all no-op instructions and unreachable code
+    if (no_op)
+      passes.add(no_op_pass);
+    if (unreachable)
+      passes.add(unreachable_pass);
 
     // Apply all the initialized algorithms
     for (auto &algorithm : goto_preprocess_algorithms)
     {
       if (cmdline.isset("function"))
         algorithm->setTarget(cmdline.getval("function"));
-      algorithm->run(goto_functions);
+      passes.add(*algorithm);
     }
 
     // do partial inlining
-    if (!cmdline.isset("no-inlining"))
-    {
+    goto_program_passt inline_pass([&](goto_functionst &goto_functions) {
       if (cmdline.isset("full-inlining"))
         goto_inline(goto_functions, options, ns);
       else
         goto_partial_inline(goto_functions, options, ns);
-    }
+    });
+    if (!cmdline.isset("no-inlining"))
+      passes.add(inline_pass);
 
-    if (cmdline.isset("gcse"))
-    {
+    goto_program_passt gcse_pass([&](goto_functionst &goto_functions) {
       std::shared_ptr<value_set_analysist> vsa =
         std::make_shared<value_set_analysist>(ns);
       try
@@ -1842,53 +1979,74 @@ bool esbmc_parseoptionst::process_goto_program(
         goto_cse cse(context, vsa);
         cse.run(goto_functions);
       }
-    }
+    });
+    if (cmdline.isset("gcse"))
+      passes.add(gcse_pass);
 
-    if (cmdline.isset("interval-analysis") || cmdline.isset("goto-contractor"))
-    {
+    goto_program_passt interval_pass([&](goto_functionst &goto_functions) {
       interval_analysis(goto_functions, ns, options);
-    }
+    });
+    if (cmdline.isset("interval-analysis") || cmdline.isset("goto-contractor"))
+      passes.add(interval_pass);
 
+    goto_program_passt k_induction_pass(
+      [](goto_functionst &goto_functions) {
+        goto_k_induction(goto_functions);
+      });
     if (
       cmdline.isset("inductive-step") || cmdline.isset("k-induction") ||
       cmdline.isset("k-induction-parallel"))
     {
       // Always remove skips before doing k-induction.
       // It seems to fix some issues for now
-      remove_no_op(goto_functions);
-      goto_k_induction(goto_functions);
+      passes.add(no_op_pass);
+      passes.add(k_induction_pass);
     }
 
-    if (
-      cmdline.isset("goto-contractor") ||
-      cmdline.isset("goto-contractor-condition"))
-    {
+    goto_program_passt contractor_pass([&](goto_functionst &goto_functions) {
 #ifdef ENABLE_GOTO_CONTRACTOR
       goto_contractor(goto_functions, ns, options);
 #else
+      (void)goto_functions;
       log_error(
         "Current build does not support contractors. If ibex is installed, add "
         "to your build process "
         "-DENABLE_GOTO_CONTRACTOR=ON -DIBEX_DIR=path-to-ibex");
       abort();
 #endif
-    }
+    });
+    if (
+      cmdline.isset("goto-contractor") ||
+      cmdline.isset("goto-contractor-condition"))
+      passes.add(contractor_pass);
 
+    goto_program_passt termination_pass(
+      [](goto_functionst &goto_functions) {
+        goto_termination(goto_functions);
+      });
     if (cmdline.isset("termination"))
-      goto_termination(goto_functions);
+      passes.add(termination_pass);
 
-    goto_check(ns, options, goto_functions);
+    goto_function_passt check_pass([&](goto_functiont &f) {
+      if (!f.body.empty())
+        goto_check(ns, options, f.body);
+    });
+    passes.add(check_pass);
 
     // add re-evaluations of monitored properties
-    add_property_monitors(goto_functions, ns);
+    goto_program_passt monitors_pass([&](goto_functionst &goto_functions) {
+      add_property_monitors(goto_functions, ns);
+    });
+    passes.add(monitors_pass);
 
     // Once again, remove all unreachable and no-op code that could have been
     // introduced by the above algorithms
-    if (!(cmdline.isset("no-remove-no-op")))
-      remove_no_op(goto_functions);
+    if (no_op)
+      passes.add(no_op_pass);
+    if (unreachable)
+      passes.add(unreachable_pass);
 
-    if (!(cmdline.isset("no-remove-unreachable") || is_mul || is_coverage))
-      remove_unreachable(goto_functions);
+    passes.run(goto_functions);
 
     goto_functions.update();
 
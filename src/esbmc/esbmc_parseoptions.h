@@ -49,6 +49,13 @@ protected:
 
   int do_bmc_strategy(optionst &options, goto_functionst &goto_functions);
 
+  int do_adaptive_unwind(
+    optionst &options,
+    goto_functionst &goto_functions,
+    uint64_t k_step_base,
+    uint64_t k_step_inc,
+    uint64_t max_k_step);
+
   int doit_k_induction_parallel();
 
   tvt is_base_case_violated(
@@ -59,7 +66,8 @@ protected:
   tvt does_forward_condition_hold(
     optionst &options,
     goto_functionst &goto_functions,
-    const uint64_t &k_step);
+    const uint64_t &k_step,
+    std::set<unsigned> *failed_loops = nullptr);
 
   tvt is_inductive_step_violated(
     optionst &options,
@@ -70,6 +78,9 @@ protected:
 
   bool set_claims(goto_functionst &goto_functions);
 
+  // the inductive step formula kept in a solver across k
+  std::unique_ptr<incremental_formulat> inductive_step_formula;
+
   uint64_t read_time_spec(const char *str);
   uint64_t read_mem_spec(const char *str);
 
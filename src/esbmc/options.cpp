@@ -72,6 +72,9 @@ const struct group_opt_templ all_cmd_options[] = {
      {"python",
       boost::program_options::value<std::string>()->value_name("path"),
       "Python interpreter binary to use (searched in $PATH; default: python)"},
+     {"python-ast-cache",
+      boost::program_options::value<std::string>()->value_name("dir"),
+      "reuse the Python ASTs generated by earlier runs, cached in dir"},
    }},
 #endif
 #ifdef ENABLE_SOLIDITY_FRONTEND
@@ -118,6 +121,14 @@ const struct group_opt_templ all_cmd_options[] = {
     {"no-abstracted-cpp-includes",
      NULL,
      "do not include abstract cpp operational models"},
+    {"clang-ast-cache",
+     boost::program_options::value<std::string>()->value_name("dir"),
+     "share the #includes C/C++ inputs start with between runs and inputs as "
+     "precompiled headers cached in dir"},
+    {"frontend-jobs",
+     boost::program_options::value<int>()->value_name("n"),
+     "parse up to n C/C++ input files concurrently (default: one per "
+     "hardware thread)"},
     {"force,f", boost::program_options::value<std::vector<std::string>>(), ""},
     {"preprocess", NULL, "stop after preprocessing"},
     {"no-inlining", NULL, "disable inlining function calls"},
@@ -242,6 +253,10 @@ const struct group_opt_templ all_cmd_options[] = {
      NULL,
      "do not unroll bounded loops at goto level (need to enable "
      "--goto-unwind)"},
+    {"goto-accelerate",
+     NULL,
+     "replace loops filling an array or accumulating an unsigned value by "
+     "their effect at goto level"},
     {"slice-assumes", NULL, "remove unused assume statements"},
     {"extended-try-analysis", NULL, ""},
     {"skip-bmc", NULL, "do not perform bounded model checking"},
@@ -251,7 +266,15 @@ const struct group_opt_templ all_cmd_options[] = {
     {"falsification", NULL, "incremental loop unwinding for bug searching"},
     {"termination",
      NULL,
-     "incremental loop unwinding assertion verification"}}},
+     "incremental loop unwinding assertion verification"},
+    {"adaptive-unwind",
+     NULL,
+     "with --incremental-bmc, only unwind further the loops whose unwinding "
+     "assertions fail"},
+    {"unwindset-output",
+     boost::program_options::value<std::string>()->value_name("path"),
+     "write the loop bounds reached by --adaptive-unwind to a file, in the "
+     "format of --unwindset"}}},
   {"Solver",
    {{"list-solvers", NULL, "list available solvers and exit"},
     {"boolector", NULL, "use Boolector (default),"},
@@ -410,6 +433,10 @@ const struct group_opt_templ all_cmd_options[] = {
      "print the counter-example produced by the inductive step"},
     {"bidirectional", NULL, ""},
     {"unlimited-k-steps", NULL, "set max number of iteration to UINT_MAX"},
+    {"incremental-inductive-step",
+     NULL,
+     "keep the inductive step formula in the solver across k and only "
+     "encode what changed"},
     {"max-inductive-step",
      boost::program_options::value<int>()->default_value(-1)->value_name("nr"),
      ""}}},
@@ -429,7 +456,14 @@ const struct group_opt_templ all_cmd_options[] = {
     {"no-por", NULL, "do not do partial order reduction"},
     {"all-runs",
      NULL,
-     "check all interleavings, even if a bug was already found"}}},
+     "check all interleavings, even if a bug was already found"},
+    {"parallel-interleavings",
+     boost::program_options::value<int>()->value_name("nr"),
+     "split the thread interleavings between nr worker processes"},
+    {"interleaving-split-depth",
+     boost::program_options::value<int>()->value_name("nr"),
+     "number of context-switch points after which the interleavings are "
+     "split between workers (default is 3)"}}},
   {"Interval Analysis",
    {{"interval-analysis",
      NULL,
@@ -6,6 +6,8 @@
 #include <cassert>
 #include <memory>
 #include <sstream>
+#include <unordered_set>
+#include <vector>
 
 #include <util/std_code.h>
 #include <util/std_expr.h>
@@ -76,17 +78,31 @@ void ai_baset::finalize()
   // Nothing to do per default
 }
 
-goto_programt::const_targett ai_baset::get_next(working_sett &working_set)
+goto_programt::const_targett ai_baset::get_next(
+  working_sett &working_set,
+  const goto_programt *&goto_program)
 {
   assert(!working_set.empty());
 
   working_sett::iterator i = working_set.begin();
-  goto_programt::const_targett l = i->second;
+  goto_program = i->second.first;
+  goto_programt::const_targett l = i->second.second;
   working_set.erase(i);
 
   return l;
 }
 
+void ai_baset::put_in_working_set(
+  working_sett &working_set,
+  const goto_programt &goto_program,
+  goto_programt::const_targett l)
+{
+  auto it = function_rank.find(&goto_program);
+  unsigned rank = it == function_rank.end() ? 0 : it->second;
+  working_set.emplace(
+    std::make_pair(rank, l->location_number), std::make_pair(&goto_program, l));
+}
+
 bool ai_baset::fixedpoint(
   const goto_programt &goto_program,
   const goto_functionst &goto_functions,
@@ -96,16 +112,19 @@ bool ai_baset::fixedpoint(
 
   // Put the first location in the working set
   if (!goto_program.empty())
-    put_in_working_set(working_set, goto_program.instructions.begin());
+    put_in_working_set(
+      working_set, goto_program, goto_program.instructions.begin());
 
   bool new_data = false;
 
   while (!working_set.empty())
   {
-    goto_programt::const_targett l = get_next(working_set);
+    const goto_programt *program;
+    goto_programt::const_targett l = get_next(working_set, program);
+    number_of_visits++;
 
     // goto_program is really only needed for iterator manipulation
-    if (visit(l, working_set, goto_program, goto_functions, ns))
+    if (visit(l, working_set, *program, goto_functions, ns))
       new_data = true;
   }
 
@@ -131,10 +150,6 @@ bool ai_baset::visit(
     if (to_l == goto_program.instructions.end())
       continue;
 
-    std::unique_ptr<statet> tmp_state(make_temporary_state(current));
-
-    statet &new_values = *tmp_state;
-
     bool have_new_values = false;
 
     if (l->is_function_call() && !goto_functions.function_map.empty())
@@ -142,7 +157,14 @@ bool ai_baset::visit(
       // this is a big special case
       const code_function_call2t &code = to_code_function_call2t(l->code);
 
-      if (do_function_call_rec(l, to_l, code.function, goto_functions, ns))
+      if (do_function_call_rec(
+            l,
+            to_l,
+            code.function,
+            working_set,
+            goto_program,
+            goto_functions,
+            ns))
         have_new_values = true;
     }
     else
@@ -150,6 +172,8 @@ bool ai_baset::visit(
       // initialize state, if necessary
       get_state(to_l);
 
+      std::unique_ptr<statet> tmp_state(make_temporary_state(current));
+      statet &new_values = *tmp_state;
       new_values.transform(l, to_l, *this, ns);
 
       if (merge(new_values, l, to_l))
@@ -159,17 +183,24 @@ bool ai_baset::visit(
     if (have_new_values)
     {
       new_data = true;
-      put_in_working_set(working_set, to_l);
+      put_in_working_set(working_set, goto_program, to_l);
     }
   }
 
+  if (l->is_end_function() && !goto_functions.function_map.empty())
+  {
+    if (apply_summary(l, working_set, goto_program, ns))
+      new_data = true;
+  }
+
   return new_data;
 }
 
 bool ai_baset::do_function_call(
   goto_programt::const_targett l_call,
   goto_programt::const_targett l_return,
-  const goto_functionst &goto_functions,
+  working_sett &working_set,
+  const goto_programt &caller,
   const goto_functionst::function_mapt::const_iterator f_it,
   const namespacet &ns)
 {
@@ -191,6 +222,11 @@ bool ai_baset::do_function_call(
 
   assert(!goto_function.body.instructions.empty());
 
+  // Remember the call site, so that later changes of the exit state of the
+  // function get propagated to it.
+  if (recorded_calls.insert(&*l_call).second)
+    call_sites[&goto_function.body].push_back({&caller, l_call, l_return});
+
   // This is the edge from call site to function head.
 
   {
@@ -204,15 +240,10 @@ bool ai_baset::do_function_call(
     std::unique_ptr<statet> tmp_state(make_temporary_state(get_state(l_call)));
     tmp_state->transform(l_call, l_begin, *this, ns);
 
-    bool new_data = false;
-
-    // merge the new stuff
+    // merge the new stuff, the body is (re-)analysed when the work-queue
+    // reaches it
     if (merge(*tmp_state, l_call, l_begin))
-      new_data = true;
-
-    // do we need to do/re-do the fixedpoint of the body?
-    if (new_data)
-      fixedpoint(goto_function.body, goto_functions, ns);
+      put_in_working_set(working_set, goto_function.body, l_begin);
   }
 
   // This is the edge from function end to return site.
@@ -227,7 +258,7 @@ bool ai_baset::do_function_call(
     const statet &end_state = get_state(l_end);
 
     if (end_state.is_bottom())
-      return false; // function exit point not reachable
+      return false; // function exit point not reachable (yet)
 
     std::unique_ptr<statet> tmp_state(make_temporary_state(end_state));
     tmp_state->transform(l_end, l_return, *this, ns);
@@ -237,10 +268,44 @@ bool ai_baset::do_function_call(
   }
 }
 
+bool ai_baset::apply_summary(
+  goto_programt::const_targett l_end,
+  working_sett &working_set,
+  const goto_programt &goto_program,
+  const namespacet &ns)
+{
+  auto it = call_sites.find(&goto_program);
+  if (it == call_sites.end())
+    return false;
+
+  const statet &end_state = get_state(l_end);
+  if (end_state.is_bottom())
+    return false;
+
+  bool new_data = false;
+  for (const call_sitet &site : it->second)
+  {
+    get_state(site.ret);
+
+    std::unique_ptr<statet> tmp_state(make_temporary_state(end_state));
+    tmp_state->transform(l_end, site.ret, *this, ns);
+
+    if (merge(*tmp_state, l_end, site.ret))
+    {
+      new_data = true;
+      put_in_working_set(working_set, *site.caller, site.ret);
+    }
+  }
+
+  return new_data;
+}
+
 bool ai_baset::do_function_call_rec(
   goto_programt::const_targett l_call,
   goto_programt::const_targett l_return,
   const expr2tc &function,
+  working_sett &working_set,
+  const goto_programt &caller,
   const goto_functionst &goto_functions,
   const namespacet &ns)
 {
@@ -251,11 +316,11 @@ bool ai_baset::do_function_call_rec(
     const irep_idt &identifier = to_symbol2t(function).thename;
 
     goto_functionst::function_mapt::const_iterator it =
-      goto_functions.function_map.find(identifier);
+      goto_functions.find(identifier);
 
     assert(it != goto_functions.function_map.end());
 
-    return do_function_call(l_call, l_return, goto_functions, it, ns);
+    return do_function_call(l_call, l_return, working_set, caller, it, ns);
   }
   /* As we do not have a points-to analysis, we can't know where a function pointer
      will point-to. For now we will assume that it always points to a valid place.
@@ -274,6 +339,55 @@ bool ai_baset::do_function_call_rec(
   return merge(*tmp_state, l_call, l_return);
 }
 
+void ai_baset::rank_functions(
+  const goto_functionst &goto_functions,
+  const goto_programt &entry)
+{
+  // Depth-first search of the call graph, ranking the bodies in reverse
+  // post-order so that callers come before their callees.
+  std::vector<const goto_programt *> post_order;
+  std::unordered_set<const goto_programt *> seen;
+  std::vector<std::pair<const goto_programt *, goto_programt::const_targett>>
+    stack;
+
+  seen.insert(&entry);
+  stack.emplace_back(&entry, entry.instructions.begin());
+  while (!stack.empty())
+  {
+    const goto_programt *program = stack.back().first;
+    goto_programt::const_targett &it = stack.back().second;
+    if (it == program->instructions.end())
+    {
+      post_order.push_back(program);
+      stack.pop_back();
+      continue;
+    }
+
+    goto_programt::const_targett l = it++;
+    if (!l->is_function_call())
+      continue;
+
+    const expr2tc &function = to_code_function_call2t(l->code).function;
+    if (!is_symbol2t(function))
+      continue;
+
+    goto_functionst::function_mapt::const_iterator f_it =
+      goto_functions.find(to_symbol2t(function).thename);
+    if (
+      f_it == goto_functions.function_map.end() ||
+      !f_it->second.body_available)
+      continue;
+
+    const goto_programt *callee = &f_it->second.body;
+    if (seen.insert(callee).second)
+      stack.emplace_back(callee, callee->instructions.begin());
+  }
+
+  function_rank.clear();
+  for (unsigned i = 0; i < post_order.size(); i++)
+    function_rank[post_order[i]] = post_order.size() - i;
+}
+
 void ai_baset::sequential_fixedpoint(
   const goto_functionst &goto_functions,
   const namespacet &ns)
@@ -281,6 +395,12 @@ void ai_baset::sequential_fixedpoint(
   goto_functionst::function_mapt::const_iterator f_it =
     goto_functions.function_map.find(goto_functions.main_id());
 
-  if (f_it != goto_functions.function_map.end())
-    fixedpoint(f_it->second.body, goto_functions, ns);
+  if (f_it == goto_functions.function_map.end())
+    return;
+
+  call_sites.clear();
+  recorded_calls.clear();
+  rank_functions(goto_functions, f_it->second.body);
+
+  fixedpoint(f_it->second.body, goto_functions, ns);
 }
@@ -4,9 +4,14 @@
 #ifndef CPROVER_ANALYSES_AI_H
 #define CPROVER_ANALYSES_AI_H
 
+#include <algorithm>
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include <goto-programs/abstract-interpretation/ai_domain.h>
 #include <goto-programs/goto_functions.h>
 #include <util/xml.h>
@@ -39,6 +44,7 @@ public:
   void operator()(const goto_programt &goto_program, const namespacet &ns)
   {
     goto_functionst goto_functions;
+    number_of_visits = 0;
     initialize(goto_program);
     entry_state(goto_program);
     fixedpoint(goto_program, goto_functions, ns);
@@ -53,6 +59,7 @@ public:
    */
   void operator()(const goto_functionst &goto_functions, const namespacet &ns)
   {
+    number_of_visits = 0;
     initialize(goto_functions);
     entry_state(goto_functions);
     fixedpoint(goto_functions, ns);
@@ -75,12 +82,23 @@ public:
   /// Resets the domain
   virtual void clear()
   {
+    call_sites.clear();
+    recorded_calls.clear();
+    function_rank.clear();
   }
 
   virtual void
   output(const goto_functionst &goto_functions, std::ostream &out) const;
 
+  /// Number of instructions visited by the last analysis
+  std::size_t get_number_of_visits() const
+  {
+    return number_of_visits;
+  }
+
 protected:
+  std::size_t number_of_visits = 0;
+
   // overload to add a factory
   virtual void initialize(const goto_programt &);
   virtual void initialize(const goto_functiont &);
@@ -95,18 +113,24 @@ protected:
   /* The fixedpoint is computed through a Work set algorithm which
    * consists in adding nodes that have changed with the current merge
   */
-  // the work-queue is sorted by location number
-  typedef std::unordered_map<unsigned, goto_programt::const_targett>
+  // the work-queue is sorted by the rank of the function (callers before
+  // callees) and then by location number. Always taking the lowest one
+  // keeps re-visiting a loop body, which lies below its exit, before the
+  // instructions after the loop. This is only a heuristic order, not a
+  // weak topological ordering, and the interval domain still widens at
+  // its merges into guard instructions rather than at loop heads
+  typedef std::map<
+    std::pair<unsigned, unsigned>,
+    std::pair<const goto_programt *, goto_programt::const_targett>>
     working_sett;
 
-  goto_programt::const_targett get_next(working_sett &working_set);
+  goto_programt::const_targett
+  get_next(working_sett &working_set, const goto_programt *&goto_program);
 
-  void
-  put_in_working_set(working_sett &working_set, goto_programt::const_targett l)
-  {
-    working_set.insert(
-      std::pair<unsigned, goto_programt::const_targett>(l->location_number, l));
-  }
+  void put_in_working_set(
+    working_sett &working_set,
+    const goto_programt &goto_program,
+    goto_programt::const_targett l);
 
   // true = found something new
   bool fixedpoint(
@@ -117,6 +141,14 @@ protected:
   virtual void
   fixedpoint(const goto_functionst &goto_functions, const namespacet &ns) = 0;
 
+  /* Interprocedural fixpoint over a single work-queue shared by all the
+   * functions reachable from the entry point. The states at the entry and
+   * exit of a function are its summary: a call joins the caller's state into
+   * the callee's entry and applies the callee's current exit state to the
+   * return site, and whenever the exit state grows it is applied again to
+   * every call site seen so far. As callers are ranked before their callees,
+   * the contexts of all the calls reaching a function are usually joined
+   * before its body is analysed, instead of re-analysing it once per call. */
   void sequential_fixedpoint(
     const goto_functionst &goto_functions,
     const namespacet &ns);
@@ -137,16 +169,46 @@ protected:
     goto_programt::const_targett l_call,
     goto_programt::const_targett l_return,
     const expr2tc &function,
+    working_sett &working_set,
+    const goto_programt &caller,
     const goto_functionst &goto_functions,
     const namespacet &ns);
 
   bool do_function_call(
     goto_programt::const_targett l_call,
     goto_programt::const_targett l_return,
-    const goto_functionst &goto_functions,
+    working_sett &working_set,
+    const goto_programt &caller,
     const goto_functionst::function_mapt::const_iterator f_it,
     const namespacet &ns);
 
+  // applies the exit state l_end of goto_program to its call sites
+  bool apply_summary(
+    goto_programt::const_targett l_end,
+    working_sett &working_set,
+    const goto_programt &goto_program,
+    const namespacet &ns);
+
+  void rank_functions(
+    const goto_functionst &goto_functions,
+    const goto_programt &entry);
+
+  struct call_sitet
+  {
+    const goto_programt *caller;
+    goto_programt::const_targett call;
+    goto_programt::const_targett ret;
+  };
+
+  // the calls seen so far to each function body
+  std::unordered_map<const goto_programt *, std::vector<call_sitet>>
+    call_sites;
+  std::unordered_set<const goto_programt::instructiont *> recorded_calls;
+
+  // position of each function body in the reverse post-order of the call
+  // graph, bodies missing from it are ranked first
+  std::unordered_map<const goto_programt *, unsigned> function_rank;
+
   // abstract methods
 
   virtual bool merge(
@@ -176,43 +238,44 @@ public:
 
   domainT &operator[](goto_programt::const_targett l)
   {
-    typename state_mapt::iterator it = state_map.find(l);
-    if (it == state_map.end())
+    domainT *s = lookup(l);
+    if (!s)
       throw "failed to find state";
 
-    return it->second;
+    return *s;
   }
 
   bool target_is_mapped(goto_programt::const_targett l) const
   {
-    return state_map.count(l) != 0;
+    return lookup(l) != nullptr;
   }
 
   const domainT &operator[](goto_programt::const_targett l) const
   {
-    typename state_mapt::const_iterator it = state_map.find(l);
-    if (it == state_map.end())
+    const domainT *s = lookup(l);
+    if (!s)
       throw "failed to find state";
 
-    return it->second;
+    return *s;
   }
 
   std::unique_ptr<statet>
   abstract_state_before(goto_programt::const_targett t) const override
   {
-    typename state_mapt::const_iterator it = state_map.find(t);
-    if (it == state_map.end())
+    const domainT *s = lookup(t);
+    if (!s)
     {
       std::unique_ptr<statet> d = std::make_unique<domainT>();
       assert(d->is_bottom());
       return d;
     }
 
-    return std::make_unique<domainT>(it->second);
+    return std::make_unique<domainT>(*s);
   }
 
   void clear() override
   {
+    dense_states.clear();
     state_map.clear();
     ai_baset::clear();
   }
@@ -224,22 +287,64 @@ protected:
     const_target_hash,
     pointee_address_equalt>
     state_mapt;
+
+  /* States are kept in a table indexed by location number, which is sized
+   * once per analysis so that references to states stay valid. Each slot
+   * records the instruction owning it: instructions whose number is out of
+   * range or already taken (e.g. added by a pass that did not renumber the
+   * program) get their state from the hash map instead. */
+  struct dense_statet
+  {
+    const goto_programt::instructiont *instruction = nullptr;
+    domainT state;
+  };
+  std::vector<dense_statet> dense_states;
   state_mapt state_map;
 
+  void initialize(const goto_programt &goto_program) override
+  {
+    if (dense_states.empty())
+      reserve_states(max_location_number(goto_program));
+    ai_baset::initialize(goto_program);
+  }
+
+  void initialize(const goto_functionst &goto_functions) override
+  {
+    unsigned max = 0;
+    forall_goto_functions (it, goto_functions)
+      max = std::max(max, max_location_number(it->second.body));
+
+    dense_states.clear();
+    state_map.clear();
+    reserve_states(max);
+    ai_baset::initialize(goto_functions);
+  }
+
+  using ai_baset::initialize;
+
   // this one creates states, if need be
   virtual statet &get_state(goto_programt::const_targett l) override
   {
+    if (l->location_number < dense_states.size())
+    {
+      dense_statet &slot = dense_states[l->location_number];
+      if (!slot.instruction)
+        slot.instruction = &*l;
+      if (slot.instruction == &*l)
+        return slot.state;
+    }
+
     return state_map[l]; // calls default constructor
   }
 
   // this one just finds states
   const statet &find_state(goto_programt::const_targett l) const override
   {
-    typename state_mapt::const_iterator it = state_map.find(l);
-    if (it == state_map.end())
+    const domainT *s = lookup(l);
+    if (!s)
       throw "failed to find state";
 
-    return it->second;
+    return *s;
   }
 
   bool merge(
@@ -264,6 +369,37 @@ protected:
   }
 
 private:
+  static unsigned max_location_number(const goto_programt &goto_program)
+  {
+    unsigned max = 0;
+    forall_goto_program_instructions (it, goto_program)
+      max = std::max(max, it->location_number);
+    return max;
+  }
+
+  void reserve_states(unsigned max)
+  {
+    dense_states.resize(std::size_t(max) + 1);
+  }
+
+  const domainT *lookup(goto_programt::const_targett l) const
+  {
+    if (l->location_number < dense_states.size())
+    {
+      const dense_statet &slot = dense_states[l->location_number];
+      if (slot.instruction == &*l)
+        return &slot.state;
+    }
+
+    typename state_mapt::const_iterator it = state_map.find(l);
+    return it == state_map.end() ? nullptr : &it->second;
+  }
+
+  domainT *lookup(goto_programt::const_targett l)
+  {
+    return const_cast<domainT *>(std::as_const(*this).lookup(l));
+  }
+
   // to enforce that domainT is derived from ai_domain_baset
   void dummy(const domainT &s)
   {
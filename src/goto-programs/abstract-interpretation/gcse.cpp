@@ -11,6 +11,12 @@
 #include <fmt/format.h>
 // TODO: Do an points-to abstract interpreter
 std::shared_ptr<value_set_analysist> cse_domaint::vsa = nullptr;
+std::unordered_map<
+  irep_idt,
+  std::unordered_set<expr2tc, irep2_hash>,
+  irep_id_hash>
+  cse_domaint::dependents;
+std::unordered_set<expr2tc, irep2_hash> cse_domaint::indexed;
 
 void cse_domaint::transform(
   goto_programt::const_targett from,
@@ -155,6 +161,7 @@ void cse_domaint::make_expression_available(const expr2tc &E)
   // Did we check it already?
   if (!added.second)
     return;
+  index_expr(E);
   // Let's recursively make it available!
   E->foreach_operand(
     [this](const expr2tc &e) { make_expression_available(e); });
@@ -183,31 +190,51 @@ bool cse_domaint::should_remove_expr(const expr2tc &taint, const expr2tc &E)
   return result;
 }
 
-bool cse_domaint::should_remove_expr(const irep_idt &sym, const expr2tc &E)
-  const
+static void collect_symbols(
+  const expr2tc &E,
+  std::unordered_set<irep_idt, irep_id_hash> &syms)
 {
   if (!E)
-    return false;
+    return;
 
-  if (is_symbol2t(E) && to_symbol2t(E).thename == sym)
-    return true;
+  if (is_symbol2t(E))
+    syms.insert(to_symbol2t(E).thename);
 
-  bool result = false;
-  E->foreach_operand([this, &result, &sym](const expr2tc &e) {
-    result |= should_remove_expr(sym, e);
-  });
-  return result;
+  E->foreach_operand([&syms](const expr2tc &e) { collect_symbols(e, syms); });
+}
+
+void cse_domaint::index_expr(const expr2tc &E)
+{
+  if (!indexed.insert(E).second)
+    return;
+
+  std::unordered_set<irep_idt, irep_id_hash> syms;
+  collect_symbols(E, syms);
+  for (const irep_idt &sym : syms)
+    dependents[sym].insert(E);
 }
 
 void cse_domaint::havoc_symbol(const irep_idt &sym)
 {
-  std::vector<expr2tc> to_remove;
-  for (auto x : available_expressions)
+  auto it = dependents.find(sym);
+  if (it == dependents.end())
+    return;
+
+  // Walk whichever side is smaller
+  if (available_expressions.size() < it->second.size())
   {
-    if (should_remove_expr(sym, x))
-      to_remove.push_back(x);
+    for (auto x = available_expressions.begin();
+         x != available_expressions.end();)
+    {
+      if (it->second.count(*x))
+        x = available_expressions.erase(x);
+      else
+        x++;
+    }
+    return;
   }
-  for (auto x : to_remove)
+
+  for (const expr2tc &x : it->second)
     available_expressions.erase(x);
 }
 
@@ -230,10 +257,39 @@ void cse_domaint::havoc_expr(
       }
     }
   }
+
+  // An expression containing the target contains its symbols as well, so
+  // only the dependents of one of them need to be checked
+  std::unordered_set<irep_idt, irep_id_hash> syms;
+  collect_symbols(target, syms);
+  const std::unordered_set<expr2tc, irep2_hash> *deps = nullptr;
+  for (const irep_idt &sym : syms)
+  {
+    auto it = dependents.find(sym);
+    if (it == dependents.end())
+      return;
+    if (!deps || it->second.size() < deps->size())
+      deps = &it->second;
+  }
+
+  // Walk whichever side is smaller
+  if (!deps || available_expressions.size() < deps->size())
+  {
+    for (auto x = available_expressions.begin();
+         x != available_expressions.end();)
+    {
+      if ((!deps || deps->count(*x)) && should_remove_expr(target, *x))
+        x = available_expressions.erase(x);
+      else
+        x++;
+    }
+    return;
+  }
+
   std::vector<expr2tc> to_remove;
-  for (auto x : available_expressions)
+  for (const expr2tc &x : *deps)
   {
-    if (should_remove_expr(target, x))
+    if (available_expressions.count(x) && should_remove_expr(target, x))
       to_remove.push_back(x);
   }
   for (auto x : to_remove)
@@ -246,6 +302,7 @@ bool goto_cse::runOnProgram(goto_functionst &F)
   const namespacet ns(context);
   log_status("{}", "[CSE] Computing Available Expressions for program");
   available_expressions(F, ns);
+  cse_domaint::clear_index();
   log_status("{}", "[CSE] Finished computing AE for program");
   // Let's release the reference. TODO: create the "VSA aware" abstract interpreter
   cse_domaint::vsa = nullptr;
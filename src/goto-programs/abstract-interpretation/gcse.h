@@ -103,10 +103,27 @@ protected:
 
   // Helper function to check whether `src` depends on `taint`
   bool should_remove_expr(const expr2tc &taint, const expr2tc &src) const;
-  // Helper function to check whether `src` depends on symbol `sym`
-  bool should_remove_expr(const irep_idt &sym, const expr2tc &src) const;
+
+  /// Add `e` to the dependents of each symbol it contains
+  static void index_expr(const expr2tc &e);
+
+  /// Every expression made available so far (in any state), by the symbols
+  /// it contains. Havocs use it to visit only the expressions they affect.
+  static std::unordered_map<
+    irep_idt,
+    std::unordered_set<expr2tc, irep2_hash>,
+    irep_id_hash>
+    dependents;
+  static std::unordered_set<expr2tc, irep2_hash> indexed;
 
 public:
+  /// Releases the index of dependent expressions
+  static void clear_index()
+  {
+    dependents.clear();
+    indexed.clear();
+  }
+
   // TODO: clearly this shouldn't be here. The proper way is to create a new Abstract Interpreter
   // that contains a points-to analysis
   static std::shared_ptr<value_set_analysist> vsa;
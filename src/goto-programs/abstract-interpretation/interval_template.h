@@ -8,6 +8,72 @@
 #include <sstream>
 #include <util/ieee_float.h>
 #include <optional>
+#include <cstdint>
+#include <limits>
+
+/* Arithmetic on interval bounds. Integer intervals keep BigInt bounds, but
+ * nearly all of them come from <=64-bit variables: when both bounds fit in
+ * an int64_t and the result cannot overflow it, the BigInt overloads below
+ * compute on machine integers and only fall back to arbitrary precision
+ * otherwise. Other bound types use their own operators. */
+namespace interval_arith
+{
+template <class T>
+T add(const T &a, const T &b)
+{
+  return a + b;
+}
+
+template <class T>
+T sub(const T &a, const T &b)
+{
+  return a - b;
+}
+
+template <class T>
+T mul(const T &a, const T &b)
+{
+  return a * b;
+}
+
+inline BigInt add(const BigInt &a, const BigInt &b)
+{
+  typedef std::numeric_limits<int64_t> limits;
+  if (a.is_int64() && b.is_int64())
+  {
+    int64_t x = a.to_int64(), y = b.to_int64();
+    if (y >= 0 ? x <= limits::max() - y : x >= limits::min() - y)
+      return BigInt(static_cast<BigInt::llong_t>(x + y));
+  }
+  return a + b;
+}
+
+inline BigInt sub(const BigInt &a, const BigInt &b)
+{
+  typedef std::numeric_limits<int64_t> limits;
+  if (a.is_int64() && b.is_int64())
+  {
+    int64_t x = a.to_int64(), y = b.to_int64();
+    if (y >= 0 ? x >= limits::min() + y : x <= limits::max() + y)
+      return BigInt(static_cast<BigInt::llong_t>(x - y));
+  }
+  return a - b;
+}
+
+inline BigInt mul(const BigInt &a, const BigInt &b)
+{
+  // Factors below 2^31 in magnitude cannot overflow an int64_t
+  const int64_t bound = int64_t(1) << 31;
+  if (a.is_int64() && b.is_int64())
+  {
+    int64_t x = a.to_int64(), y = b.to_int64();
+    if (x > -bound && x < bound && y > -bound && y < bound)
+      return BigInt(static_cast<BigInt::llong_t>(x * y));
+  }
+  return a * b;
+}
+} // namespace interval_arith
+
 /**
  * @brief This class is used to store intervals
  * in the form of lower <= upper. It also has support
@@ -290,12 +356,12 @@ public:
     if (!lhs.lower || !rhs.lower)
       result.lower.reset();
     else
-      result.lower = *lhs.lower + *rhs.lower;
+      result.lower = interval_arith::add(*lhs.lower, *rhs.lower);
 
     if (!lhs.upper || !rhs.upper)
       result.upper.reset();
     else
-      result.upper = *lhs.upper + *rhs.upper;
+      result.upper = interval_arith::add(*lhs.upper, *rhs.upper);
 
     return result;
   }
@@ -333,12 +399,12 @@ public:
     if (!lhs.lower || !rhs.upper)
       result.lower.reset();
     else
-      result.lower = *lhs.lower - *rhs.upper;
+      result.lower = interval_arith::sub(*lhs.lower, *rhs.upper);
 
     if (!lhs.upper || !rhs.lower)
       result.upper.reset();
     else
-      result.upper = *lhs.upper - *rhs.lower;
+      result.upper = interval_arith::sub(*lhs.upper, *rhs.lower);
 
     return result;
   }
@@ -356,7 +422,7 @@ public:
       return result;
 
     // Initialize with a0 * b0
-    auto a0_b0 = *lhs.lower * *rhs.lower;
+    auto a0_b0 = interval_arith::mul(*lhs.lower, *rhs.lower);
     result.lower = a0_b0;
     result.upper = a0_b0;
 
@@ -365,9 +431,9 @@ public:
       result.upper = std::max(value, *result.upper);
     };
 
-    update_value(*lhs.lower * *rhs.upper); // a0 * b1
-    update_value(*lhs.upper * *rhs.lower); // a1 * b0
-    update_value(*lhs.upper * *rhs.upper); // a1 * b1
+    update_value(interval_arith::mul(*lhs.lower, *rhs.upper)); // a0 * b1
+    update_value(interval_arith::mul(*lhs.upper, *rhs.lower)); // a1 * b0
+    update_value(interval_arith::mul(*lhs.upper, *rhs.upper)); // a1 * b1
 
     return result;
   }
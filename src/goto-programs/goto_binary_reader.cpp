@@ -2,9 +2,7 @@
 #include <goto-programs/read_bin_goto_object.h>
 #include <goto-programs/goto_functions.h>
 #include <util/message.h>
-#include <fstream>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/stream.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 
 bool goto_binary_reader::read_goto_binary_array(
   const void *data,
@@ -12,9 +10,17 @@ bool goto_binary_reader::read_goto_binary_array(
   contextt &context,
   goto_functionst &dest)
 {
-  using namespace boost::iostreams;
-  stream<array_source> src(static_cast<const char *>(data), size);
-  return read_bin_goto_object(src, "", context, functions, dest);
+  return read_bin_goto_object(
+    static_cast<const char *>(data), size, "", context, filter, dest);
+}
+
+bool goto_binary_reader::read_goto_binary_array_deps(
+  const void *data,
+  size_t size,
+  symbol_depst &deps)
+{
+  return read_bin_goto_object_deps(
+    static_cast<const char *>(data), size, "", deps);
 }
 
 bool goto_binary_reader::read_goto_binary(
@@ -22,6 +28,19 @@ bool goto_binary_reader::read_goto_binary(
   contextt &context,
   goto_functionst &dest)
 {
-  std::ifstream in(path, std::ios::in | std::ios::binary);
-  return read_bin_goto_object(in, path, context, dest);
+  // Map the file rather than streaming it, so that only the records we decode
+  // are ever paged in.
+  boost::iostreams::mapped_file_source file;
+  try
+  {
+    file.open(path);
+  }
+  catch (const std::exception &e)
+  {
+    log_error("Cannot map goto binary `{}': {}", path, e.what());
+    return true;
+  }
+
+  return read_bin_goto_object(
+    file.data(), file.size(), path, context, filter, dest);
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <goto-programs/read_bin_goto_object.h>
 #include <util/context.h>
 #include <vector>
 #include <string>
@@ -16,9 +17,21 @@ public:
     contextt &context,
     goto_functionst &dest);
 
+  /** Reads just the symbol dependency index, if any, of a goto binary. */
+  bool read_goto_binary_array_deps(
+    const void *data,
+    size_t size,
+    symbol_depst &deps);
+
   void set_functions_to_read(const std::vector<std::string> &funcs)
   {
-    functions = funcs;
+    filter.functions.clear();
+    filter.functions.insert(funcs.begin(), funcs.end());
+  }
+
+  void set_symbols_to_read(symbol_id_sett symbols)
+  {
+    filter.symbols = std::move(symbols);
   }
 
   bool read_goto_binary(
@@ -27,5 +40,5 @@ public:
     goto_functionst &dest);
 
 private:
-  std::vector<std::string> functions; // functions to read
+  goto_binary_filtert filter; // symbols to read
 };
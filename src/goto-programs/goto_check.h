@@ -9,6 +9,11 @@
 // to invoke "get_base_object" for input overflow checks
 #include <util/type_byte_size.h>
 
+void goto_check(
+  const namespacet &ns,
+  optionst &options,
+  goto_programt &goto_program);
+
 void goto_check(
   const namespacet &ns,
   optionst &options,
@@ -11,7 +11,7 @@ void goto_contractor(
   goto_functions.update();
 }
 
-void goto_contractort::get_contractors(goto_functionst goto_functions)
+void goto_contractort::get_contractors(const goto_functionst &goto_functions)
 {
   auto function = goto_functions.function_map.find("c:@F@main");
   for (const auto &ins : function->second.body.instructions)
@@ -32,7 +32,7 @@ void goto_contractort::get_contractors(goto_functionst goto_functions)
 }
 
 void goto_contractort::get_intervals(
-  goto_functionst goto_functions,
+  const goto_functionst &goto_functions,
   const namespacet &ns)
 {
   ait<interval_domaint> interval_analysis;
@@ -43,7 +43,7 @@ void goto_contractort::get_intervals(
 
   auto f_it = goto_functions.function_map.find("c:@F@main");
   {
-    Forall_goto_program_instructions (i_it, f_it->second.body)
+    forall_goto_program_instructions (i_it, f_it->second.body)
     {
       if (
         i_it->is_assert() ||
@@ -84,7 +84,6 @@ void goto_contractort::get_intervals(
       }
     }
   }
-  goto_functions.update();
 }
 
 void goto_contractort::parse_intervals(expr2tc expr)
@@ -145,7 +144,7 @@ void goto_contractort::parse_intervals(expr2tc expr)
   }
 }
 
-void goto_contractort::insert_assume(goto_functionst goto_functions)
+void goto_contractort::insert_assume(goto_functionst &goto_functions)
 {
   loopst loop;
   unsigned int last_loc = 0;
@@ -162,7 +161,8 @@ void goto_contractort::insert_assume(goto_functionst goto_functions)
 
   goto_programt dest;
 
-  auto goto_function = goto_functions.function_map.find("c:@F@main")->second;
+  goto_functiont &goto_function =
+    goto_functions.function_map.find("c:@F@main")->second;
 
   if (map.is_empty_set())
   {
@@ -235,8 +235,8 @@ bool goto_contractort::initialize_main_function_loops()
 }
 
 void goto_contractort::insert_assume_at(
-  goto_functiont goto_function,
-  std::_List_iterator<goto_programt::instructiont> instruction)
+  goto_functiont &goto_function,
+  goto_programt::targett instruction)
 {
   /// Here we build an assume instruction with a conjunction of multiple conditions.
   /// We start with a true expression and add other conditions with and2tc
@@ -294,6 +294,15 @@ void goto_contractort::goto_contractor_condition(
   interval_analysis(goto_functions, namespacet);
   std::ostringstream oss;
 
+  // The analysis only needs to be run again once assumes were inserted
+  bool program_changed = false;
+  auto update_intervals = [&]() {
+    if (!program_changed)
+      return;
+    interval_analysis(goto_functions, namespacet);
+    program_changed = false;
+  };
+
   Forall_goto_functions (f_it, goto_functions)
   {
     Forall_goto_program_instructions (i_it, f_it->second.body)
@@ -316,7 +325,7 @@ void goto_contractort::goto_contractor_condition(
             continue;
           }
 
-          interval_analysis(goto_functions, namespacet);
+          update_intervals();
           for (const auto &i : *interval_analysis[i_it].intervals)
           {
             if (i.second.index() != 0)
@@ -352,10 +361,12 @@ void goto_contractort::goto_contractor_condition(
               //ELSE clause gets the inner contractor results
               auto next = std::next(i_it);
               insert_assume_at(f_it->second, next);
+              program_changed = true;
               map.update_intervals(X_in);
               goto_target++;
 
               insert_assume_at(f_it->second, goto_target);
+              program_changed = true;
             }
             else
             {
@@ -370,6 +381,7 @@ void goto_contractort::goto_contractor_condition(
             next++;
 
             insert_assume_at(f_it->second, next);
+            program_changed = true;
           }
           delete (vars);
         }
@@ -394,7 +406,7 @@ void goto_contractort::goto_contractor_condition(
         }
 
         //get intervals and convert them to ibex intervals by updating the map
-        interval_analysis(goto_functions, namespacet);
+        update_intervals();
         for (const auto &i : *interval_analysis[i_it].intervals)
         {
           if (i.second.index() != 0)
@@ -418,6 +430,7 @@ void goto_contractort::goto_contractor_condition(
         next++;
 
         insert_assume_at(f_it->second, next);
+        program_changed = true;
         delete (vars);
       }
     }
@@ -569,7 +569,7 @@ private:
   /// the function will return nothing. However the contractors be added to
   /// the list of contractors.
   /// \param functionst list of functions in the goto program
-  void get_contractors(goto_functionst goto_functions);
+  void get_contractors(const goto_functionst &goto_functions);
 
   /// \Function get_intervals is a function that will go through each assert in
   /// the program and parse it from ESBMC expression to a triplet that are the
@@ -578,7 +578,9 @@ private:
   /// return nothing. However the values of the intervals of each variable will
   /// be updated in the Map that holds the variable information.
   /// \param functionst list of functions in the goto program
-  void get_intervals(goto_functionst functionst, const namespacet &namespacet);
+  void get_intervals(
+    const goto_functionst &functionst,
+    const namespacet &namespacet);
 
   /// \Function contractor function will apply the contractor on the parsed
   /// constraint and intervals. it will apply the inner contractor by
@@ -606,15 +608,15 @@ private:
    * @param goto_functions goto program functions
    * @param vector result from the contractor.
    */
-  void insert_assume(goto_functionst goto_functions);
+  void insert_assume(goto_functionst &goto_functions);
 
   void parse_intervals(expr2tc);
 
   bool initialize_main_function_loops();
 
   void insert_assume_at(
-    goto_functiont goto_function,
-    std::_List_iterator<goto_programt::instructiont> instruction);
+    goto_functiont &goto_function,
+    goto_programt::targett instruction);
 };
 //-----------------------------------------------------------------------------------------------------------------
 class interval_analysis_ibex_contractor
@@ -188,6 +188,26 @@ void goto_functionst::output(const namespacet &ns, std::ostream &out) const
   }
 }
 
+goto_functionst::function_mapt::iterator
+goto_functionst::lookup(const irep_idt &name) const
+{
+  function_mapt &map = const_cast<function_mapt &>(function_map);
+
+  // Functions erased from the map directly: the index may refer to them
+  if (index.size() > map.size())
+    index.clear();
+
+  auto it = index.find(name);
+  if (it != index.end())
+    return it->second;
+
+  // Misses are not recorded, the function may be added later
+  function_mapt::iterator f_it = map.find(name);
+  if (f_it != map.end())
+    index.emplace(name, f_it);
+  return f_it;
+}
+
 void goto_functionst::compute_location_numbers()
 {
   unsigned nr = 0;
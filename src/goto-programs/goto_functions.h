@@ -14,6 +14,8 @@
        it++)
 
 #include <goto-programs/goto_program.h>
+#include <memory>
+#include <unordered_map>
 #include <util/std_types.h>
 
 class goto_functiont
@@ -36,17 +38,89 @@ public:
   }
 };
 
+class goto_loopst;
+
 class goto_functionst
 {
 public:
   typedef std::map<irep_idt, goto_functiont> function_mapt;
   function_mapt function_map;
 
+  goto_functionst() = default;
+
+  // The index refers to the nodes of this object's map, it is not copied
+  goto_functionst(const goto_functionst &other)
+    : function_map(other.function_map)
+  {
+  }
+
+  // Moving the map hands its nodes over, and their iterators stay valid
+  goto_functionst(goto_functionst &&other) noexcept
+    : function_map(std::move(other.function_map)),
+      index(std::move(other.index))
+  {
+    other.index.clear();
+    other.loop_cache.clear();
+  }
+
+  goto_functionst &operator=(const goto_functionst &other)
+  {
+    function_map = other.function_map;
+    index.clear();
+    loop_cache.clear();
+    return *this;
+  }
+
+  goto_functionst &operator=(goto_functionst &&other) noexcept
+  {
+    function_map = std::move(other.function_map);
+    index = std::move(other.index);
+    other.index.clear();
+    loop_cache.clear();
+    other.loop_cache.clear();
+    return *this;
+  }
+
   void clear()
   {
     function_map.clear();
+    index.clear();
+    loop_cache.clear();
+  }
+
+  /// Looks a function up by name like function_map.find(), but through a
+  /// hash index instead of walking the tree, for hot paths such as the
+  /// dispatch of calls during symex. The index is filled as functions are
+  /// looked up. Functions must be removed through erase() while it is in use.
+  function_mapt::iterator find(const irep_idt &name)
+  {
+    return lookup(name);
+  }
+
+  function_mapt::const_iterator find(const irep_idt &name) const
+  {
+    return lookup(name);
+  }
+
+  function_mapt::iterator erase(function_mapt::iterator it)
+  {
+    index.erase(it->first);
+    loop_cache.erase(it->first);
+    return function_map.erase(it);
   }
 
+  void erase(const irep_idt &name)
+  {
+    index.erase(name);
+    loop_cache.erase(name);
+    function_map.erase(name);
+  }
+
+  /// The loops of a function body, found on first use and kept until
+  /// update(). Passes that change the body must call update() before
+  /// asking for its loops again, and should not use this while they do.
+  const goto_loopst &get_function_loops(function_mapt::iterator it);
+
   void output(const namespacet &ns, std::ostream &out) const;
   void dump() const;
 
@@ -56,6 +130,7 @@ public:
 
   void update()
   {
+    loop_cache.clear();
     compute_target_numbers();
     compute_location_numbers();
     compute_loop_numbers();
@@ -69,7 +144,20 @@ public:
   void swap(goto_functionst &other)
   {
     function_map.swap(other.function_map);
+    index.swap(other.index);
+    loop_cache.clear();
+    other.loop_cache.clear();
   }
+
+private:
+  mutable std::unordered_map<irep_idt, function_mapt::iterator, irep_id_hash>
+    index;
+
+  function_mapt::iterator lookup(const irep_idt &name) const;
+
+  // Not copied either, the loops refer to the instructions of this object
+  std::unordered_map<irep_idt, std::shared_ptr<goto_loopst>, irep_id_hash>
+    loop_cache;
 };
 
 void get_local_identifiers(const goto_functiont &, std::set<irep_idt> &dest);
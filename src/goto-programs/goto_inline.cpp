@@ -209,7 +209,7 @@ void goto_inlinet::expand_function_call(
   }
 
   goto_functionst::function_mapt::iterator m_it =
-    goto_functions.function_map.find(identifier);
+    goto_functions.find(identifier);
 
   if (m_it == goto_functions.function_map.end())
   {
@@ -64,6 +64,24 @@ void goto_loopst::find_function_loops()
       create_function_loop(loop_head, loop_exit);
     }
   }
+
+  index_loops();
+}
+
+void goto_loopst::index_loops()
+{
+  loop_by_number.clear();
+  for (const loopst &loop : function_loops)
+    loop_by_number[loop.get_original_loop_exit()->loop_number] = &loop;
+}
+
+const goto_loopst &
+goto_functionst::get_function_loops(function_mapt::iterator it)
+{
+  std::shared_ptr<goto_loopst> &loops = loop_cache[it->first];
+  if (!loops)
+    loops = std::make_shared<goto_loopst>(it->first, *this, it->second);
+  return *loops;
 }
 
 void goto_loopst::create_function_loop(
@@ -137,7 +155,7 @@ void goto_loopst::get_modified_variables(
 
     // find code in function map
     goto_functionst::function_mapt::iterator it =
-      goto_functions.function_map.find(identifier);
+      goto_functions.find(identifier);
 
     if (it == goto_functions.function_map.end())
     {
@@ -3,6 +3,7 @@
 
 #include <goto-programs/goto_functions.h>
 #include <goto-programs/loopst.h>
+#include <unordered_map>
 #include <util/std_types.h>
 
 class goto_loopst
@@ -29,6 +30,10 @@ protected:
 
   void add_loop_var(loopst &loop, const expr2tc &expr, bool is_modified);
 
+  void index_loops();
+
+  std::unordered_map<unsigned, const loopst *> loop_by_number;
+
 public:
   goto_loopst(
     const irep_idt &_function_name,
@@ -41,6 +46,10 @@ public:
     find_function_loops();
   }
 
+  // The index refers to the loops of this object
+  goto_loopst(const goto_loopst &) = delete;
+  goto_loopst &operator=(const goto_loopst &) = delete;
+
   void find_function_loops();
   void dump() const;
 
@@ -48,6 +57,13 @@ public:
   {
     return function_loops;
   }
+
+  /// The loop with the given loop number, if any
+  const loopst *get_loop(unsigned loop_number) const
+  {
+    auto it = loop_by_number.find(loop_number);
+    return it == loop_by_number.end() ? nullptr : it->second;
+  }
 };
 
 #endif /* GOTO_PROGRAMS_GOTO_LOOPS_H_ */
@@ -0,0 +1,141 @@
+#include <goto-programs/loop_acceleration.h>
+#include <goto-programs/loop_unroll.h>
+#include <irep2/irep2_utils.h>
+
+/// Whether e may evaluate differently in two iterations of a loop that
+/// only assigns to counter and target
+static bool is_loop_variant(
+  const expr2tc &e,
+  const expr2tc &counter,
+  const expr2tc &target)
+{
+  if (is_nil_expr(e))
+    return false;
+
+  // nondet values change at every evaluation and a dereference may read
+  // the object being assigned
+  if (is_sideeffect2t(e) || is_dereference2t(e))
+    return true;
+
+  if (is_symbol2t(e))
+  {
+    const irep_idt &name = to_symbol2t(e).thename;
+    return name == to_symbol2t(counter).thename ||
+           name == to_symbol2t(target).thename;
+  }
+
+  bool variant = false;
+  e->foreach_operand([&](const expr2tc &op) {
+    variant = variant || is_loop_variant(op, counter, target);
+  });
+  return variant;
+}
+
+/// Whether index is symbol, possibly converted to types that hold every
+/// value from 0 to k - 1 the counter takes, so no two iterations store to
+/// the same element
+static bool is_counter(const expr2tc &index, const expr2tc &symbol, int k)
+{
+  if (is_typecast2t(index))
+  {
+    if (!is_bv_type(index))
+      return false;
+
+    unsigned bits = index->type->get_width();
+    if (is_signedbv_type(index))
+      bits--;
+    if (bits < 31 && (k - 1) >> bits != 0)
+      return false;
+
+    return is_counter(to_typecast2t(index).from, symbol, k);
+  }
+  return index == symbol;
+}
+
+expr2tc loop_accelerator::accelerate(
+  const code_assign2t &assign,
+  const expr2tc &symbol,
+  int k0,
+  int k) const
+{
+  // a[i] = c, over all the elements of a
+  if (is_index2t(assign.target))
+  {
+    const index2t &index = to_index2t(assign.target);
+    const expr2tc &array = index.source_value;
+    if (!is_symbol2t(array) || !is_array_type(array))
+      return expr2tc();
+
+    const array_type2t &type = to_array_type(array->type);
+    if (
+      type.size_is_infinite || !is_constant_int2t(type.array_size) ||
+      k0 != 0 || to_constant_int2t(type.array_size).value != k)
+      return expr2tc();
+
+    if (
+      !is_counter(index.index, symbol, k) ||
+      is_loop_variant(assign.source, symbol, array))
+      return expr2tc();
+
+    return code_assign2tc(
+      array, constant_array_of2tc(array->type, assign.source));
+  }
+
+  // s = s + c, which wraps around the same way in one step as in many
+  if (is_symbol2t(assign.target) && is_unsignedbv_type(assign.target))
+  {
+    const expr2tc &sum = assign.target;
+    if (!is_add2t(assign.source) || to_add2t(assign.source).side_1 != sum)
+      return expr2tc();
+
+    const expr2tc &step = to_add2t(assign.source).side_2;
+    if (is_loop_variant(step, symbol, sum))
+      return expr2tc();
+
+    expr2tc times = constant_int2tc(sum->type, BigInt(k - k0));
+    return code_assign2tc(
+      sum, add2tc(sum->type, sum, mul2tc(sum->type, times, step)));
+  }
+
+  return expr2tc();
+}
+
+bool loop_accelerator::runOnLoop(loopst &loop, goto_programt &)
+{
+  expr2tc symbol;
+  int k0 = 0, k = 0;
+  if (!get_counting_loop_bounds(loop, symbol, k0, k))
+    return false;
+
+  goto_programt::targett head = loop.get_original_loop_head();
+  goto_programt::targett exit = loop.get_original_loop_exit();
+  goto_programt::targett increment = std::prev(exit);
+
+  // The body must be a single assignment, so nothing else jumps into
+  // the loop or out of it
+  goto_programt::targett body = increment;
+  for (goto_programt::targett t = std::next(head); t != increment; t++)
+  {
+    if (t->is_skip() || t->is_location())
+      continue;
+    if (!t->is_assign() || body != increment)
+      return false;
+    body = t;
+  }
+
+  if (body == increment)
+    return false;
+
+  expr2tc accelerated = accelerate(to_code_assign2t(body->code), symbol, k0, k);
+  if (is_nil_expr(accelerated))
+    return false;
+
+  // k0 < k, so the loop is always entered and leaves the counter at k
+  head->make_skip();
+  body->code = accelerated;
+  increment->code = code_assign2tc(symbol, constant_int2tc(symbol->type, k));
+  exit->make_skip();
+
+  number_of_accelerated_loops++;
+  return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <util/algorithms.h>
+#include <util/message.h>
+
+/**
+ * @brief This goes through every loop of the program looking for
+ * counting loops (see get_counting_loop_bounds) whose body is a single
+ * assignment that does the same thing at every iteration, and replaces
+ * them by the effect of the whole loop:
+ *
+ * for(i = 0; i < N; i++) a[i] = c;    // a has N elements
+ *
+ * becomes a = ARRAY_OF(c); i = N; and
+ *
+ * for(i = K0; i < K; i++) s = s + c;  // s is unsigned
+ *
+ * becomes s = s + (K - K0) * c; i = K, where c is an expression that
+ * does not depend on the loop. Every other loop is left untouched to
+ * be unwound as usual.
+ *
+ * The iterations are done at once: a concurrent program observing the
+ * intermediate values of the loop should not use this.
+ */
+class loop_accelerator : public goto_functions_algorithm
+{
+public:
+  loop_accelerator() : goto_functions_algorithm(true)
+  {
+  }
+
+  bool is_function_local() const override
+  {
+    return true;
+  }
+
+  /**
+   * @brief Get the number of loops that were replaced
+   *        after the algorithm has run
+   *
+   * @return number of accelerated loops
+   */
+  unsigned get_number_of_accelerated_loops()
+  {
+    return number_of_accelerated_loops;
+  }
+
+protected:
+  bool runOnLoop(loopst &loop, goto_programt &goto_program) override;
+
+  /**
+   * @brief Computes the assignment equivalent to running the loop
+   * body assignment from k0 to k
+   *
+   * @return nil if the assignment is not one of the known forms
+   */
+  expr2tc accelerate(
+    const code_assign2t &assign,
+    const expr2tc &symbol,
+    int k0,
+    int k) const;
+
+private:
+  unsigned number_of_accelerated_loops = 0;
+};
@@ -68,7 +68,11 @@ bool unsound_loop_unroller::runOnLoop(loopst &loop, goto_programt &goto_program)
   return true;
 }
 
-int bounded_loop_unroller::get_loop_bounds(loopst &loop)
+bool get_counting_loop_bounds(
+  loopst &loop,
+  expr2tc &symbol,
+  int &k0,
+  int &k)
 {
   /**
    * This looks for the following template
@@ -80,31 +84,29 @@ int bounded_loop_unroller::get_loop_bounds(loopst &loop)
    * b: symbol++
    *
    * If this is matched properly then set
-   * bound as k - k0 and return true
+   * bounds as [k0, k) and return true
    */
   goto_programt::targett t = loop.get_original_loop_head();
-  expr2tc symbol;
-  int k = 0;
 
   // 1. Check the condition. 't' should be IF !(symbol < K) THEN GOTO x
   if (!t->is_goto() || !is_not2t(t->guard))
-    return -1;
+    return false;
 
   // Pattern match symbol and K, if the relation is <= then K = K + 1
   {
     auto &cond = to_not2t(t->guard).value;
     if (!is_lessthan2t(cond) && !is_lessthanequal2t(cond))
-      return -1;
+      return false;
 
     if (
       !is_symbol2t(*cond->get_sub_expr(0)) ||
       !is_constant_int2t(*cond->get_sub_expr(1)))
-      return -1;
+      return false;
 
     symbol = *cond->get_sub_expr(0);
     k = to_constant_int2t(*cond->get_sub_expr(1)).value.to_int64();
     if (k < 0)
-      return -1;
+      return false;
 
     if (is_lessthanequal2t(cond))
       k++;
@@ -115,35 +117,34 @@ int bounded_loop_unroller::get_loop_bounds(loopst &loop)
   // 2. Check for symbol = symbol + 1
   te--; // the previous instruction should be the increment
   if (!te->is_assign())
-    return -1;
+    return false;
   // for now only increments of one will work
   {
     auto &x = to_code_assign2t(te->code);
     if (x.target != symbol || !is_add2t(x.source))
-      return -1;
+      return false;
 
     auto &add = to_add2t(x.source);
     if (add.side_1 != symbol || !is_constant_int2t(add.side_2))
-      return -1;
+      return false;
 
     if (to_constant_int2t(add.side_2).value.to_int64() != 1)
-      return -1;
+      return false;
   }
 
   // 3. Look for k0
   t--; // Previous instruction from the loop creation
-  int k0 = 0;
   if (!t->is_assign())
-    return -1;
+    return false;
   // Pattern matching k0 from symbol = k0
   {
     auto &x = to_code_assign2t(t->code);
     if (x.target != symbol || !is_constant_int2t(x.source))
-      return -1;
+      return false;
 
     k0 = to_constant_int2t(x.source).value.to_int64();
     if (k0 < 0 || k0 >= k)
-      return -1;
+      return false;
   }
 
   // 3. It mustn't exist an assignment over symbol inside the loop
@@ -155,9 +156,19 @@ int bounded_loop_unroller::get_loop_bounds(loopst &loop)
     {
       auto &x = to_code_assign2t(t->code);
       if (x.target == symbol)
-        return -1;
+        return false;
     }
 
+  return true;
+}
+
+int bounded_loop_unroller::get_loop_bounds(loopst &loop)
+{
+  expr2tc symbol;
+  int k0 = 0, k = 0;
+  if (!get_counting_loop_bounds(loop, symbol, k0, k))
+    return -1;
+
   int bound = k - k0;
   if (bound <= 0 || (size_t)bound > unroll_limit)
     return 0;
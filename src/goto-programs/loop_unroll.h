@@ -21,6 +21,11 @@ public:
   {
   }
 
+  bool is_function_local() const override
+  {
+    return true;
+  }
+
 protected:
   bool runOnLoop(loopst &loop, goto_programt &goto_program) override;
 
@@ -33,6 +38,28 @@ protected:
   virtual int get_loop_bounds(loopst &loop) = 0;
 };
 
+/**
+ * @brief Matches the counting loop
+ *
+ * SYMBOL = K0
+ * 1: IF !(SYMBOL < K) THEN GOTO 2
+ *    P
+ *    SYMBOL = SYMBOL + 1
+ *    GOTO 1
+ * 2: Q
+ *
+ * where K0 and K are constants, 0 <= K0 < K (a <= condition counts as
+ * K + 1) and P does not assign SYMBOL.
+ *
+ * @return whether the loop matched, in which case SYMBOL takes the
+ * values [k0, k) in the loop
+ */
+bool get_counting_loop_bounds(
+  loopst &loop,
+  expr2tc &symbol,
+  int &k0,
+  int &k);
+
 /**
  * @brief This goes through every loop of the program and tries to
  * check if it is a bounded loop, if it is, it will be unrolled all
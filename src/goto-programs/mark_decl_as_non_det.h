@@ -17,6 +17,11 @@ public:
   {
   }
 
+  bool is_function_local() const override
+  {
+    return true;
+  }
+
 protected:
   contextt &context;
   virtual bool
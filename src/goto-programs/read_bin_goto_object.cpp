@@ -1,124 +1,400 @@
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <goto-programs/goto_function_serialization.h>
 #include <goto-programs/goto_program_irep.h>
 #include <goto-programs/read_bin_goto_object.h>
+#include <goto-programs/write_goto_binary.h>
+#include <iterator>
 #include <langapi/mode.h>
 #include <util/base_type.h>
 #include <util/irep_serialization.h>
 #include <util/namespace.h>
 #include <util/symbol_serialization.h>
 
-#define BINARY_VERSION 1
+namespace
+{
+/* Bounds-checked reader over an in-memory goto binary, using the same
+ * encoding as write_long() and write_string(). */
+class bin_cursort
+{
+public:
+  bin_cursort(const char *begin, const char *end) : p(begin), end(end)
+  {
+  }
 
-bool read_bin_goto_object(
-  std::istream &in,
-  const std::string &filename,
-  contextt &context,
-  std::vector<std::string> &functions,
-  goto_functionst &goto_functions)
+  bool read_long(unsigned &u)
+  {
+    if (end - p < 4)
+      return true;
+    u = 0;
+    for (unsigned i = 0; i < 4; i++)
+      u = (u << 8) | static_cast<unsigned char>(*p++);
+    return false;
+  }
+
+  bool read_string(std::string &s)
+  {
+    s.clear();
+    while (p != end && *p != 0)
+    {
+      if (*p == '\\' && ++p == end)
+        return true;
+      s.push_back(*p++);
+    }
+    if (p == end)
+      return true;
+    p++; // terminator
+    return false;
+  }
+
+  const char *p;
+  const char *end;
+};
+
+struct directory_entryt
+{
+  irep_idt name;
+  unsigned offset;
+  unsigned size;
+};
+} // namespace
+
+static void check_header(
+  const char *data,
+  size_t size,
+  const std::string &filename)
 {
   std::ostringstream str;
 
+  if (size >= 3 && data[0] == 'G' && data[1] == 'B' && data[2] == 'F')
+    return;
+
+  if (size >= 4 && data[0] == 0x7f && data[1] == 'E' && data[2] == 'L' &&
+      data[3] == 'F')
   {
-    char hdr[4];
-    hdr[0] = in.get();
-    hdr[1] = in.get();
-    hdr[2] = in.get();
+    if (filename != "")
+      str << "Sorry, but I can't read ELF binary `" << filename << "'";
+    else
+      str << "Sorry, but I can't read ELF binaries";
+  }
+  else
+    str << "`" << filename << "' is not a goto-binary."
+        << "\n";
 
-    if (hdr[0] != 'G' || hdr[1] != 'B' || hdr[2] != 'F')
-    {
-      hdr[3] = in.get();
+  log_error("{}", str.str());
+  abort();
+}
 
-      if (hdr[0] == 0x7f && hdr[1] == 'E' && hdr[2] == 'L' && hdr[3] == 'F')
-      {
-        if (filename != "")
-          str << "Sorry, but I can't read ELF binary `" << filename << "'";
-        else
-          str << "Sorry, but I can't read ELF binaries";
-      }
-      else
-        str << "`" << filename << "' is not a goto-binary."
-            << "\n";
+static unsigned check_version(unsigned version)
+{
+  if (version != 1 && version != GOTO_BINARY_VERSION)
+  {
+    log_error(
+      "The input was compiled with a different version of goto-cc, please "
+      "recompile");
+    abort();
+  }
 
-      log_error("{}", str.str());
-      abort();
-    }
+  return version;
+}
+
+static void add_symbol(
+  const irept &t,
+  const goto_binary_filtert &filter,
+  contextt &context,
+  goto_functionst &goto_functions)
+{
+  if (!t.is_type() && t.type().is_code())
+  {
+    // makes sure there is an empty function
+    // for every function symbol and fixes
+    // the function types.
+    auto it = goto_functions.function_map.find(t.name());
+    if (it == goto_functions.function_map.end())
+      goto_functions.function_map.emplace(t.name(), goto_functiont());
+    goto_functions.function_map.at(t.name()).type = to_code_type(t.type());
   }
 
+  // Skip symbols not asked for before paying for the conversion
+  if (!filter.symbols.empty() && !filter.symbols.count(t.name()))
+    return;
+
+  symbolt symbol;
+  symbol.from_irep(t);
+
+  // Add functions only from the list
+  if (
+    !filter.functions.empty() &&
+    !filter.functions.count(symbol.get_function_name().as_string()))
+    return;
+
+  context.add(symbol);
+}
+
+static void
+add_function_body(const irep_idt &fname, const irept &t, goto_functionst &dest)
+{
+  auto it = dest.function_map.find(fname);
+  if (it == dest.function_map.end())
+    it = dest.function_map.emplace(fname, goto_functiont()).first;
+  goto_functiont &f = it->second;
+  convert(t, f.body);
+  f.body_available = f.body.instructions.size() > 0;
+}
+
+/* Version 1: one stream in which ireps and strings may refer back to any
+ * earlier record, so everything has to be read in order. */
+static bool read_bin_goto_object_stream(
+  std::istream &in,
+  const goto_binary_filtert &filter,
+  contextt &context,
+  goto_functionst &goto_functions)
+{
   irep_serializationt::ireps_containert ic;
   irep_serializationt irepconverter(ic);
   symbol_serializationt symbolconverter(ic);
   goto_function_serializationt gfconverter(ic);
 
-  {
-    unsigned version = irepconverter.read_long(in);
+  unsigned count = irepconverter.read_long(in);
 
-    if (version != BINARY_VERSION)
-    {
-      str << "The input was compiled with a different version of "
-          << "goto-cc, please recompile";
-      log_error("{}", str.str());
-      abort();
-    }
+  for (unsigned i = 0; i < count; i++)
+  {
+    irept t;
+    symbolconverter.convert(in, t);
+    add_symbol(t, filter, context, goto_functions);
   }
 
-  unsigned count = irepconverter.read_long(in);
+  assert(migrate_namespace_lookup);
 
+  count = irepconverter.read_long(in);
   for (unsigned i = 0; i < count; i++)
   {
     irept t;
-    symbolconverter.convert(in, t);
-    symbolt symbol;
-    symbol.from_irep(t);
+    dstring fname = irepconverter.read_string(in);
+    gfconverter.convert(in, t);
+    add_function_body(fname, t, goto_functions);
+  }
 
-    if (!symbol.is_type && symbol.type.is_code())
+  return false;
+}
+
+/* Random-access format: reads the string table, the directories and, if
+ * present, the dependency index, leaving `in` at the first record. */
+static bool read_bin_goto_object_index(
+  bin_cursort &in,
+  irep_serializationt::ireps_containert &ic,
+  std::vector<directory_entryt> &symbols,
+  std::vector<directory_entryt> &bodies,
+  symbol_depst *deps)
+{
+  unsigned flags, count;
+  if (in.read_long(flags) || in.read_long(count))
+    return true;
+
+  std::string s;
+  for (unsigned i = 0; i < count; i++)
+  {
+    unsigned id;
+    if (in.read_long(id) || in.read_string(s))
+      return true;
+    if (id >= ic.string_rev_map.size())
+      ic.string_rev_map.resize(id + 1, std::pair<bool, dstring>(false, ""));
+    ic.string_rev_map[id] = std::pair<bool, dstring>(true, s);
+  }
+
+  auto name = [&ic](unsigned id, irep_idt &dest) {
+    if (id >= ic.string_rev_map.size() || !ic.string_rev_map[id].first)
+      return true;
+    dest = ic.string_rev_map[id].second;
+    return false;
+  };
+
+  for (std::vector<directory_entryt> *directory : {&symbols, &bodies})
+  {
+    if (in.read_long(count))
+      return true;
+    directory->resize(count);
+    for (directory_entryt &e : *directory)
     {
-      // makes sure there is an empty function
-      // for every function symbol and fixes
-      // the function types.
-      auto it = goto_functions.function_map.find(symbol.id);
-      if (it == goto_functions.function_map.end())
-        goto_functions.function_map.emplace(symbol.id, goto_functiont());
-      goto_functions.function_map.at(symbol.id).type =
-        to_code_type(symbol.type);
+      unsigned id;
+      if (
+        in.read_long(id) || name(id, e.name) || in.read_long(e.offset) ||
+        in.read_long(e.size))
+        return true;
     }
+  }
 
-    // Add functions only from the list
-    if (!functions.empty())
+  if (flags & GBF_SYMBOL_DEPS)
+  {
+    if (in.read_long(count))
+      return true;
+    if (deps)
+      deps->reserve(count);
+    for (unsigned i = 0; i < count; i++)
     {
-      auto it = std::find(
-        functions.begin(), functions.end(), symbol.get_function_name().c_str());
-      if (it == functions.end())
-        continue;
+      unsigned id, n;
+      irep_idt sym, dep;
+      if (in.read_long(id) || name(id, sym) || in.read_long(n))
+        return true;
+      std::vector<irep_idt> *dest = deps ? &(*deps)[sym] : nullptr;
+      for (unsigned j = 0; j < n; j++)
+      {
+        if (in.read_long(id) || name(id, dep))
+          return true;
+        if (dest)
+          dest->push_back(dep);
+      }
     }
+  }
+
+  return false;
+}
+
+static bool read_bin_goto_object_indexed(
+  bin_cursort &in,
+  const std::string &filename,
+  const goto_binary_filtert &filter,
+  contextt &context,
+  goto_functionst &goto_functions)
+{
+  irep_serializationt::ireps_containert ic;
+  ic.string_table = true;
+  symbol_serializationt symbolconverter(ic);
+  goto_function_serializationt gfconverter(ic);
+
+  std::vector<directory_entryt> symbols, bodies;
+  if (read_bin_goto_object_index(in, ic, symbols, bodies, nullptr))
+  {
+    log_error("Malformed goto binary `{}'", filename);
+    return true;
+  }
+
+  const char *records = in.p;
+  size_t records_size = in.end - in.p;
 
-    context.add(symbol);
+  // Records are self-contained: decode each one from its own slice.
+  auto decode = [&](const directory_entryt &e, auto &converter, irept &t) {
+    if (e.offset > records_size || e.size > records_size - e.offset)
+      return true;
+    using namespace boost::iostreams;
+    stream<array_source> src(records + e.offset, e.size);
+    ic.clear_ireps();
+    converter.convert(src, t);
+    return src.fail();
+  };
+
+  for (const directory_entryt &e : symbols)
+  {
+    if (!filter.symbols.empty() && !filter.symbols.count(e.name))
+      continue;
+
+    irept t;
+    if (decode(e, symbolconverter, t))
+    {
+      log_error("Malformed symbol `{}' in goto binary `{}'", e.name, filename);
+      return true;
+    }
+    add_symbol(t, filter, context, goto_functions);
   }
 
   assert(migrate_namespace_lookup);
 
-  count = irepconverter.read_long(in);
-  for (unsigned i = 0; i < count; i++)
+  for (const directory_entryt &e : bodies)
   {
+    if (!filter.symbols.empty() && !filter.symbols.count(e.name))
+      continue;
+
     irept t;
-    dstring fname = irepconverter.read_string(in);
-    gfconverter.convert(in, t);
-    auto it = goto_functions.function_map.find(fname);
-    if (it == goto_functions.function_map.end())
-      goto_functions.function_map.emplace(fname, goto_functiont());
-    goto_functiont &f = goto_functions.function_map.at(fname);
-    convert(t, f.body);
-    f.body_available = f.body.instructions.size() > 0;
+    if (decode(e, gfconverter, t))
+    {
+      log_error(
+        "Malformed function `{}' in goto binary `{}'", e.name, filename);
+      return true;
+    }
+    add_function_body(e.name, t, goto_functions);
   }
 
   return false;
 }
 
+bool read_bin_goto_object(
+  const char *data,
+  size_t size,
+  const std::string &filename,
+  contextt &context,
+  const goto_binary_filtert &filter,
+  goto_functionst &goto_functions)
+{
+  check_header(data, size, filename);
+
+  bin_cursort in(data + 3, data + size);
+  unsigned version;
+  if (in.read_long(version))
+  {
+    log_error("Malformed goto binary `{}'", filename);
+    return true;
+  }
+
+  if (check_version(version) == GOTO_BINARY_VERSION)
+    return read_bin_goto_object_indexed(
+      in, filename, filter, context, goto_functions);
+
+  using namespace boost::iostreams;
+  stream<array_source> src(in.p, in.end - in.p);
+  return read_bin_goto_object_stream(
+    src, filter, context, goto_functions);
+}
+
 bool read_bin_goto_object(
   std::istream &in,
   const std::string &filename,
   contextt &context,
+  const goto_binary_filtert &filter,
   goto_functionst &goto_functions)
 {
-  std::vector<std::string> empty;
-  return read_bin_goto_object(in, filename, context, empty, goto_functions);
+  std::string data(
+    (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  return read_bin_goto_object(
+    data.data(), data.size(), filename, context, filter, goto_functions);
+}
+
+bool read_bin_goto_object(
+  std::istream &in,
+  const std::string &filename,
+  contextt &context,
+  goto_functionst &goto_functions)
+{
+  goto_binary_filtert all;
+  return read_bin_goto_object(in, filename, context, all, goto_functions);
+}
+
+bool read_bin_goto_object_deps(
+  const char *data,
+  size_t size,
+  const std::string &filename,
+  symbol_depst &deps)
+{
+  check_header(data, size, filename);
+
+  bin_cursort in(data + 3, data + size);
+  unsigned version;
+  if (in.read_long(version))
+  {
+    log_error("Malformed goto binary `{}'", filename);
+    return true;
+  }
+
+  // Version 1 binaries carry no index
+  if (check_version(version) == 1)
+    return false;
+
+  irep_serializationt::ireps_containert ic;
+  std::vector<directory_entryt> symbols, bodies;
+  if (read_bin_goto_object_index(in, ic, symbols, bodies, &deps))
+  {
+    log_error("Malformed goto binary `{}'", filename);
+    return true;
+  }
+
+  return false;
 }
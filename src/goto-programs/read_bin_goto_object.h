@@ -2,11 +2,33 @@
 #define READ_BIN_GOTO_OBJECT_H_
 
 #include <goto-programs/goto_functions.h>
+#include <goto-programs/symbol_deps.h>
 #include <util/context.h>
 #include <util/message.h>
-#include <vector>
+#include <unordered_set>
 #include <string>
 
+/** Restricts which symbols of a goto binary are added to the context. Empty
+ *  sets accept every symbol. */
+struct goto_binary_filtert
+{
+  /* by symbolt::get_function_name() */
+  std::unordered_set<std::string> functions;
+  /* by symbol id; also restricts which function bodies are decoded */
+  symbol_id_sett symbols;
+};
+
+/** Parses the goto binary held in `data`. Records of binaries written in the
+ *  random-access format that `filter` rejects are not decoded at all.
+ *  @return true on error, false on success */
+bool read_bin_goto_object(
+  const char *data,
+  size_t size,
+  const std::string &filename,
+  contextt &context,
+  const goto_binary_filtert &filter,
+  goto_functionst &goto_functions);
+
 /** Parses `in`. If failing to do so, a message is printed to `msg_hndlr`.
  *  @return true on error, false on success */
 bool read_bin_goto_object(
@@ -19,7 +41,16 @@ bool read_bin_goto_object(
   std::istream &in,
   const std::string &filename,
   contextt &context,
-  std::vector<std::string> &functions,
+  const goto_binary_filtert &filter,
   goto_functionst &goto_functions);
 
+/** Reads only the symbol dependency index of `data`, leaving `deps` empty if
+ *  the binary was written without one.
+ *  @return true on error, false on success */
+bool read_bin_goto_object_deps(
+  const char *data,
+  size_t size,
+  const std::string &filename,
+  symbol_depst &deps);
+
 #endif /*READ_BIN_GOTO_OBJECT_H_*/
@@ -310,7 +310,7 @@ void static_analysis_baset::do_function_call_rec(
     recursion_set.insert(identifier);
 
     goto_functionst::function_mapt::const_iterator it =
-      goto_functions.function_map.find(identifier);
+      goto_functions.find(identifier);
 
     if (it == goto_functions.function_map.end())
       throw "failed to find function " + id2string(identifier);
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <goto-programs/symbol_deps.h>
+
+static void collect_irep_deps(const irept &irep, std::vector<irep_idt> &deps)
+{
+  if (irep.id() == "symbol")
+  {
+    deps.push_back(irep.identifier());
+    return;
+  }
+
+  forall_irep (it, irep.get_sub())
+  {
+    if (it->id() == "argument")
+      deps.push_back(it->cmt_identifier());
+    else
+      collect_irep_deps(*it, deps);
+  }
+
+  forall_named_irep (it, irep.get_named_sub())
+  {
+    if (it->second.id() == "symbol")
+      deps.push_back(it->second.identifier());
+    else if (it->second.id() == "argument")
+      deps.push_back(it->second.cmt_identifier());
+    else
+      collect_irep_deps(it->second, deps);
+  }
+}
+
+void collect_symbol_deps(const symbolt &symbol, std::vector<irep_idt> &deps)
+{
+  collect_irep_deps(symbol.value, deps);
+  collect_irep_deps(symbol.type, deps);
+
+  std::sort(deps.begin(), deps.end(), [](const irep_idt &a, const irep_idt &b) {
+    return a.get_no() < b.get_no();
+  });
+  deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+}
+
+void collect_symbol_deps(const contextt &context, symbol_depst &deps)
+{
+  context.foreach_operand([&deps](const symbolt &s) {
+    collect_symbol_deps(s, deps[s.id]);
+  });
+}
+
+void symbol_deps_closure(
+  const symbol_depst &deps,
+  std::vector<irep_idt> roots,
+  symbol_id_sett &needed)
+{
+  while (!roots.empty())
+  {
+    irep_idt name = roots.back();
+    roots.pop_back();
+
+    if (!needed.insert(name).second)
+      continue;
+
+    auto it = deps.find(name);
+    if (it == deps.end())
+      continue;
+
+    for (const irep_idt &dep : it->second)
+      if (!needed.count(dep))
+        roots.push_back(dep);
+  }
+}
@@ -0,0 +1,25 @@
+#ifndef CPROVER_GOTO_PROGRAMS_SYMBOL_DEPS_H_
+#define CPROVER_GOTO_PROGRAMS_SYMBOL_DEPS_H_
+
+#include <unordered_map>
+#include <unordered_set>
+#include <util/context.h>
+#include <vector>
+
+/** Maps each symbol of a goto binary to the identifiers its type and value
+ *  refer to directly. Used to pull in only the needed parts of a library. */
+typedef std::unordered_map<irep_idt, std::vector<irep_idt>, irep_id_hash>
+  symbol_depst;
+
+typedef std::unordered_set<irep_idt, irep_id_hash> symbol_id_sett;
+
+void collect_symbol_deps(const symbolt &symbol, std::vector<irep_idt> &deps);
+void collect_symbol_deps(const contextt &context, symbol_depst &deps);
+
+/** Adds to `needed` every identifier transitively reachable from `roots`. */
+void symbol_deps_closure(
+  const symbol_depst &deps,
+  std::vector<irep_idt> roots,
+  symbol_id_sett &needed);
+
+#endif
@@ -1,49 +1,122 @@
+#include <algorithm>
 #include <fstream>
 #include <goto-programs/goto_function_serialization.h>
+#include <goto-programs/symbol_deps.h>
 #include <goto-programs/write_goto_binary.h>
+#include <sstream>
 #include <util/irep_serialization.h>
 #include <util/message.h>
 #include <util/symbol_serialization.h>
 
+namespace
+{
+struct directory_entryt
+{
+  unsigned name;
+  unsigned offset;
+  unsigned size;
+};
+} // namespace
+
+static void write_directory(
+  std::ostream &out,
+  const std::vector<directory_entryt> &directory)
+{
+  write_long(out, directory.size());
+  for (const directory_entryt &e : directory)
+  {
+    write_long(out, e.name);
+    write_long(out, e.offset);
+    write_long(out, e.size);
+  }
+}
+
 bool write_goto_binary(
   std::ostream &out,
   const contextt &lcontext,
-  goto_functionst &functions)
+  goto_functionst &functions,
+  bool symbol_deps)
 {
-  // header
-  out << "GBF";
-  write_long(out, GOTO_BINARY_VERSION);
-
   irep_serializationt::ireps_containert irepc;
+  irepc.string_table = true;
   irep_serializationt irepconverter(irepc);
   symbol_serializationt symbolconverter(irepc);
   goto_function_serializationt gfconverter(irepc);
 
-  write_long(out, lcontext.size());
+  // Records are buffered, as the string table preceding them is only known
+  // once all of them have been encoded.
+  std::ostringstream records, deps;
+  std::vector<directory_entryt> symbols, bodies;
 
-  lcontext.foreach_operand([&symbolconverter, &out](const symbolt &s) {
-    symbolconverter.convert(s, out);
-  });
+  auto string_no = [&irepc](const irep_idt &s) {
+    unsigned id = s.get_no();
+    if (id >= irepc.string_map.size())
+      irepc.string_map.resize(id + 1, false);
+    irepc.string_map[id] = true;
+    return id;
+  };
 
-  unsigned cnt = 0;
-  forall_goto_functions (it, functions)
-    if (it->second.body_available)
-      cnt++;
+  auto record = [&records](unsigned name, unsigned start) {
+    unsigned end = records.tellp();
+    return directory_entryt{name, start, end - start};
+  };
 
-  write_long(out, cnt);
+  symbols.reserve(lcontext.size());
+  lcontext.foreach_operand([&](const symbolt &s) {
+    unsigned start = records.tellp();
+    irepc.clear_ireps();
+    symbolconverter.convert(s, records);
+    symbols.push_back(record(string_no(s.id), start));
+  });
 
   for (auto &it : functions.function_map)
   {
     if (it.second.body_available)
     {
       it.second.body.compute_location_numbers();
-      write_string(out, it.first.as_string());
-      gfconverter.convert(it.second, out);
+      unsigned start = records.tellp();
+      irepc.clear_ireps();
+      gfconverter.convert(it.second, records);
+      bodies.push_back(record(string_no(it.first), start));
+    }
+  }
+
+  if (symbol_deps)
+  {
+    write_long(deps, lcontext.size());
+
+    std::vector<irep_idt> ids;
+    lcontext.foreach_operand([&](const symbolt &s) {
+      ids.clear();
+      collect_symbol_deps(s, ids);
+      write_long(deps, string_no(s.id));
+      write_long(deps, ids.size());
+      for (const irep_idt &dep : ids)
+        write_long(deps, string_no(dep));
+    });
+  }
+
+  // header
+  out << "GBF";
+  write_long(out, GOTO_BINARY_VERSION);
+  write_long(out, symbol_deps ? GBF_SYMBOL_DEPS : 0);
+
+  const string_containert &strings = get_string_container();
+  write_long(
+    out, std::count(irepc.string_map.begin(), irepc.string_map.end(), true));
+  for (unsigned i = 0; i < irepc.string_map.size(); i++)
+  {
+    if (irepc.string_map[i])
+    {
+      write_long(out, i);
+      write_string(out, strings.get_string(i));
     }
   }
 
-  //irepconverter.output_map(f);
-  //irepconverter.output_string_map(f);
+  write_directory(out, symbols);
+  write_directory(out, bodies);
+  out << deps.str();
+  out << records.str();
 
-  return false;
+  return !out.good();
 }
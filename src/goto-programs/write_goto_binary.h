@@ -1,15 +1,34 @@
 #ifndef CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H_
 #define CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H_
 
-#define GOTO_BINARY_VERSION 1
+/* Version 3 binaries are random-access:
+ *
+ *   "GBF" version flags
+ *   string table       count, (number, string)*
+ *   symbol directory   count, (name, offset, size)*
+ *   function directory count, (name, offset, size)*
+ *   dependency index   count, (name, count, name*)*   if GBF_SYMBOL_DEPS
+ *   records
+ *
+ * Names are string numbers and offsets are relative to the first record.
+ * Every record is encoded on its own, referring only to the string table, so
+ * readers can decode just the records they want. Readers still accept
+ * version 1, a single stream of symbols and then functions. */
+#define GOTO_BINARY_VERSION 3
+
+#define GBF_SYMBOL_DEPS 0x1
 
 #include <goto-programs/goto_functions.h>
 #include <ostream>
 #include <util/context.h>
 
+/** Writes `lcontext` and `functions` to `out`. If `symbol_deps` is set, the
+ *  direct dependencies of every symbol are recorded as well, allowing readers
+ *  to load only the symbols they need. */
 bool write_goto_binary(
   std::ostream &out,
   const contextt &lcontext,
-  goto_functionst &functions);
+  goto_functionst &functions,
+  bool symbol_deps = false);
 
 #endif
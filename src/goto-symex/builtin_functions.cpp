@@ -757,7 +757,7 @@ void goto_symext::intrinsic_spawn_thread(
   const irep_idt &symname = to_symbol2t(addrof.ptr_obj).thename;
 
   goto_functionst::function_mapt::const_iterator it =
-    art.goto_functions.function_map.find(symname);
+    art.goto_functions.find(symname);
   if (it == art.goto_functions.function_map.end())
   {
     log_error("Spawning thread \"{}\": symbol not found", symname);
@@ -918,7 +918,7 @@ void goto_symext::symex_va_arg(const expr2tc &lhs, const sideeffect2t &code)
   const symbolt *s = new_context.find_symbol(id);
   if (s != nullptr)
   {
-    type2tc symbol_type = migrate_type(s->type);
+    const type2tc &symbol_type = ns.migrated_type(*s);
 
     va_rhs = symbol2tc(symbol_type, s->id);
     cur_state->top().level1.get_ident_name(va_rhs);
@@ -1561,45 +1561,31 @@ ends_with(std::string const &value, std::string const &ending)
 
 bool goto_symext::run_builtin(
   const code_function_call2t &func_call,
-  const std::string &symname)
+  intrinsict kind)
 {
   if (
-    has_prefix(symname, "c:@F@__builtin_sadd") ||
-    has_prefix(symname, "c:@F@__builtin_uadd") ||
-    has_prefix(symname, "c:@F@__builtin_ssub") ||
-    has_prefix(symname, "c:@F@__builtin_usub") ||
-    has_prefix(symname, "c:@F@__builtin_smul") ||
-    has_prefix(symname, "c:@F@__builtin_umul"))
+    kind == intrinsict::BUILTIN_ADD_OVERFLOW ||
+    kind == intrinsict::BUILTIN_SUB_OVERFLOW ||
+    kind == intrinsict::BUILTIN_MUL_OVERFLOW)
   {
-    assert(ends_with(symname, "_overflow"));
+    assert(ends_with(
+      to_symbol2t(func_call.function).thename.as_string(), "_overflow"));
     assert(func_call.operands.size() == 3);
 
     const auto &func_type = to_code_type(func_call.function->type);
     assert(func_type.arguments[0] == func_type.arguments[1]);
     assert(is_pointer_type(func_type.arguments[2]));
 
-    bool is_mult = has_prefix(symname, "c:@F@__builtin_smul") ||
-                   has_prefix(symname, "c:@F@__builtin_umul");
-    bool is_add = has_prefix(symname, "c:@F@__builtin_sadd") ||
-                  has_prefix(symname, "c:@F@__builtin_uadd");
-    bool is_sub = has_prefix(symname, "c:@F@__builtin_ssub") ||
-                  has_prefix(symname, "c:@F@__builtin_usub");
-
     expr2tc op;
-    if (is_mult)
+    if (kind == intrinsict::BUILTIN_MUL_OVERFLOW)
       op = mul2tc(
         func_type.arguments[0], func_call.operands[0], func_call.operands[1]);
-    else if (is_add)
+    else if (kind == intrinsict::BUILTIN_ADD_OVERFLOW)
       op = add2tc(
         func_type.arguments[0], func_call.operands[0], func_call.operands[1]);
-    else if (is_sub)
+    else
       op = sub2tc(
         func_type.arguments[0], func_call.operands[0], func_call.operands[1]);
-    else
-    {
-      log_error("Unknown overflow intrinsics");
-      abort();
-    }
 
     // Assign result of the two arguments to the dereferenced third argument
     symex_assign(code_assign2tc(
@@ -1614,7 +1600,7 @@ bool goto_symext::run_builtin(
     return true;
   }
 
-  if (has_prefix(symname, "c:@F@__builtin_constant_p"))
+  if (kind == intrinsict::BUILTIN_CONSTANT_P)
   {
     expr2tc op1 = func_call.operands[0];
     cur_state->rename(op1);
@@ -1644,8 +1630,8 @@ void goto_symext::replace_races_check(expr2tc &expr)
     // replace with __ESBMC_races_flag[address_of(var)]
     const races_check2t &obj = to_races_check2t(expr);
 
-    expr2tc flag;
-    migrate_expr(symbol_expr(*ns.lookup("c:@F@__ESBMC_races_flag")), flag);
+    expr2tc flag =
+      ns.migrated_symbol_expr(*ns.lookup("c:@F@__ESBMC_races_flag"));
 
     expr2tc index_expr = index2tc(get_bool_type(), flag, obj.value);
     expr = index_expr;
@@ -22,8 +22,8 @@ void goto_symext::default_replace_dynamic_allocation(expr2tc &expr)
 
     expr2tc obj_expr = pointer_object2tc(pointer_type2(), obj.value);
 
-    expr2tc alloc_arr_2;
-    migrate_expr(symbol_expr(*ns.lookup(valid_ptr_arr_name)), alloc_arr_2);
+    expr2tc alloc_arr_2 =
+      ns.migrated_symbol_expr(*ns.lookup(valid_ptr_arr_name));
 
     expr2tc index_expr = index2tc(get_bool_type(), alloc_arr_2, obj_expr);
     expr = index_expr;
@@ -35,8 +35,8 @@ void goto_symext::default_replace_dynamic_allocation(expr2tc &expr)
 
     expr2tc obj_expr = pointer_object2tc(pointer_type2(), ptr.ptr_obj);
 
-    expr2tc alloc_arr_2;
-    migrate_expr(symbol_expr(*ns.lookup(valid_ptr_arr_name)), alloc_arr_2);
+    expr2tc alloc_arr_2 =
+      ns.migrated_symbol_expr(*ns.lookup(valid_ptr_arr_name));
 
     expr2tc index_expr = index2tc(get_bool_type(), alloc_arr_2, obj_expr);
     expr2tc notindex = not2tc(index_expr);
@@ -48,8 +48,7 @@ void goto_symext::default_replace_dynamic_allocation(expr2tc &expr)
     // So, add the precondition that invalid_ptr only ever applies to dynamic
     // objects.
 
-    expr2tc sym_2;
-    migrate_expr(symbol_expr(*ns.lookup(dyn_info_arr_name)), sym_2);
+    expr2tc sym_2 = ns.migrated_symbol_expr(*ns.lookup(dyn_info_arr_name));
 
     expr2tc ptr_obj = pointer_object2tc(pointer_type2(), ptr.ptr_obj);
     expr2tc is_dyn = index2tc(get_bool_type(), sym_2, ptr_obj);
@@ -73,8 +72,8 @@ void goto_symext::default_replace_dynamic_allocation(expr2tc &expr)
 
     expr2tc obj_expr = pointer_object2tc(pointer_type2(), obj.value);
 
-    expr2tc alloc_arr_2;
-    migrate_expr(symbol_expr(*ns.lookup(valid_ptr_arr_name)), alloc_arr_2);
+    expr2tc alloc_arr_2 =
+      ns.migrated_symbol_expr(*ns.lookup(valid_ptr_arr_name));
 
     if (is_symbol2t(obj.value))
       expr = index2tc(get_bool_type(), alloc_arr_2, obj_expr);
@@ -92,8 +91,8 @@ void goto_symext::default_replace_dynamic_allocation(expr2tc &expr)
 
     expr2tc obj_expr = pointer_object2tc(pointer_type2(), size.value);
 
-    expr2tc alloc_arr_2;
-    migrate_expr(symbol_expr(*ns.lookup(alloc_size_arr_name)), alloc_arr_2);
+    expr2tc alloc_arr_2 =
+      ns.migrated_symbol_expr(*ns.lookup(alloc_size_arr_name));
 
     expr2tc index_expr = index2tc(size_type2(), alloc_arr_2, obj_expr);
     expr = index_expr;
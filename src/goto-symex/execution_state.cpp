@@ -1128,27 +1128,26 @@ crypto_hash execution_statet::generate_hash() const
   assert(l2 != nullptr);
 
   crypto_hash state = l2->generate_l2_state_hash();
-  std::string str = state.to_string();
 
+  crypto_hash h;
+  h.ingest(state.hash, sizeof(state.hash));
   for (const auto &it : threads_state)
   {
-    goto_programt::const_targett pc = it.source.pc;
-    int id = pc->location_number;
-    std::stringstream s;
-    s << id;
-    str += "!" + s.str();
+    unsigned int id = it.source.pc->location_number;
+    h.ingest(&id, sizeof(id));
   }
-
-  crypto_hash h;
-  h.ingest(str.c_str(), str.size());
   h.fin();
 
   return h;
 }
 
-crypto_hash execution_statet::update_hash_for_assignment(const expr2tc &rhs)
+crypto_hash execution_statet::update_hash_for_assignment(
+  const irep_idt &name,
+  const expr2tc &rhs)
 {
   crypto_hash h;
+  const std::string &str = name.as_string();
+  h.ingest(str.c_str(), str.size() + 1);
   rhs->hash(h);
   h.fin();
   return h;
@@ -1346,38 +1345,29 @@ void execution_statet::state_hashing_level2t::make_assignment(
   const expr2tc &const_value,
   const expr2tc &assigned_value)
 {
-  //  crypto_hash hash;
-
   renaming::level2t::make_assignment(lhs_sym, const_value, assigned_value);
 
   // If there's no body to the assignment, don't hash.
   if (!is_nil_expr(assigned_value))
   {
     // XXX - consider whether to use l1 names instead. Recursion, reentrancy.
-    crypto_hash hash = owner->update_hash_for_assignment(assigned_value);
-    std::string orig_name = to_symbol2t(lhs_sym).thename.as_string();
-    current_hashes[orig_name] = hash;
+    const irep_idt &orig_name = to_symbol2t(lhs_sym).thename;
+    crypto_hash hash =
+      owner->update_hash_for_assignment(orig_name, assigned_value);
+
+    // Swap this variable's old contribution to the state hash for the new one.
+    auto [it, inserted] = current_hashes.emplace(orig_name, hash);
+    if (!inserted)
+    {
+      state_hash.toggle(it->second);
+      it->second = hash;
+    }
+    state_hash.toggle(hash);
   }
 }
 
 crypto_hash
 execution_statet::state_hashing_level2t::generate_l2_state_hash() const
 {
-  unsigned int total;
-  size_t hash_sz = sizeof(crypto_hash::hash);
-
-  uint8_t *data =
-    (uint8_t *)alloca(current_hashes.size() * hash_sz * sizeof(uint8_t));
-
-  total = 0;
-  for (const auto &current_hashe : current_hashes)
-  {
-    memcpy(&data[total * hash_sz], current_hashe.second.hash, hash_sz);
-    total++;
-  }
-
-  crypto_hash c;
-  c.ingest(data, total * hash_sz);
-  c.fin();
-  return c;
+  return state_hash;
 }
@@ -11,6 +11,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <irep2/irep2.h>
 #include <util/message.h>
 #include <util/std_expr.h>
@@ -110,6 +111,9 @@ public:
    *  State-hashing level2t.
    *  When using this level2t, any assignment made is caught, and the symbolic
    *  names are hashed. This is the primary handler for state hashing.
+   *  The hash of the whole l2 state is kept up to date on every assignment
+   *  by combining the per-variable hashes commutatively, so reading it at a
+   *  context switch point does not depend on the number of variables.
    */
   class state_hashing_level2t : public ex_state_level2t
   {
@@ -122,8 +126,12 @@ public:
       const expr2tc &const_value,
       const expr2tc &assigned_value) override;
     crypto_hash generate_l2_state_hash() const;
-    typedef std::map<irep_idt, crypto_hash> current_state_hashest;
+    typedef std::unordered_map<irep_idt, crypto_hash, irep_id_hash>
+      current_state_hashest;
+    /** Hash of each variable's name and current value */
     current_state_hashest current_hashes;
+    /** Combination of all hashes in current_hashes */
+    crypto_hash state_hash;
   };
 
   // Macros
@@ -448,20 +456,22 @@ public:
 
   /**
    *  Generate hash of entire execution state.
-   *  This takes all current symbolic assignments to variables contained in the
-   *  l2 renaming object, and their precomputed hashes, concatonates them with
-   *  the current program counter of each thread, and hashes that. This results
-   *  in a full hash of the current execution state.
+   *  This takes the incrementally maintained hash of all current symbolic
+   *  assignments in the l2 renaming object, combines it with the current
+   *  program counter of each thread, and hashes that. This results in a full
+   *  hash of the current execution state.
    *  @return Hash of entire current execution state.
    */
   crypto_hash generate_hash() const;
 
   /**
-   *  Generate hash of an expression.
+   *  Generate hash of a variable being assigned an expression.
+   *  @param name Name of the variable being assigned.
    *  @param rhs Expression to hash.
-   *  @return Hash of passed in expression.
+   *  @return Hash of the name together with the passed in expression.
    */
-  crypto_hash update_hash_for_assignment(const expr2tc &rhs);
+  crypto_hash
+  update_hash_for_assignment(const irep_idt &name, const expr2tc &rhs);
 
   /**
    *  Print stack trace of each thread to stdout.
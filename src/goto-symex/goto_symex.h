@@ -76,6 +76,75 @@ public:
 
   typedef goto_symex_statet statet;
 
+  /**
+   *  Function calls that symex implements itself rather than by stepping
+   *  into a body. A callee name is mapped to one of these exactly once, see
+   *  classify_call; afterwards dispatch is a table lookup on the dstring
+   *  number instead of a chain of string comparisons per call.
+   */
+  enum class intrinsict : unsigned char
+  {
+    NONE,
+    SCANF,
+    BUILTIN_ADD_OVERFLOW,
+    BUILTIN_SUB_OVERFLOW,
+    BUILTIN_MUL_OVERFLOW,
+    BUILTIN_CONSTANT_P,
+    BUILTIN_OTHER,
+    YIELD,
+    SWITCH_TO,
+    SWITCH_AWAY_FROM,
+    GET_THREAD_ID,
+    SET_THREAD_INTERNAL_DATA,
+    GET_THREAD_INTERNAL_DATA,
+    SPAWN_THREAD,
+    TERMINATE_THREAD,
+    GET_THREAD_STATE,
+    REALLY_ATOMIC_BEGIN,
+    REALLY_ATOMIC_END,
+    SWITCH_TO_MONITOR,
+    SWITCH_FROM_MONITOR,
+    REGISTER_MONITOR,
+    KILL_MONITOR,
+    MEMSET,
+    GET_OBJECT_SIZE,
+    CONVERTVECTOR,
+    SHUFFLEVECTOR,
+    ATOMIC_LOAD,
+    ATOMIC_STORE,
+    IS_LITTLE_ENDIAN,
+    NO_ABNORMAL_MEMORY_LEAK,
+    ESBMC_CONSTANT_P,
+    INIT_OBJECT,
+    MEMORY_LEAK_CHECKS,
+    BITCAST,
+    UNREACHABLE,
+    BUMP_CALL,
+    UNKNOWN_ESBMC
+  };
+
+  /**
+   *  Map a callee name to the intrinsic it denotes. The result is memoised
+   *  per dstring number, so only the first call to a given name pays for the
+   *  string comparisons.
+   *  @param id Name of the called function.
+   *  @return Intrinsic kind, or intrinsict::NONE for ordinary functions.
+   */
+  static intrinsict classify_call(const irep_idt &id);
+
+  /** Whether the intrinsic is one of the __ESBMC_* family. */
+  static bool is_esbmc_intrinsic(intrinsict kind)
+  {
+    return kind >= intrinsict::YIELD;
+  }
+
+  /** Whether the intrinsic is one of the __builtin_* family. */
+  static bool is_builtin_intrinsic(intrinsict kind)
+  {
+    return kind >= intrinsict::BUILTIN_ADD_OVERFLOW &&
+           kind <= intrinsict::BUILTIN_OTHER;
+  }
+
   /**
    *  Class recording the outcome of symbolic execution.
    *  Contains the things that are of interest to the BMC class: The object
@@ -297,6 +366,17 @@ protected:
    */
   void loop_bound_exceeded(const expr2tc &guard);
 
+  /**
+   *  Jump straight to the target of a forward GOTO that is always taken.
+   *  Rather than saving a copy of the state for the target and walking the
+   *  skipped instructions with a false guard, move the program counter. This
+   *  is only done when none of the skipped instructions has an effect under a
+   *  false guard or is the target of a pending jump.
+   *  @param goto_target Target of the jump.
+   *  @return True if the jump was performed.
+   */
+  bool jump_forward(goto_programt::const_targett goto_target);
+
   // function calls
 
   /**
@@ -388,22 +468,23 @@ protected:
    *  @param call Function call being performed.
    *  @param art Reachability tree we're operating on.
    *  @param symname Name of intrinsic we're calling.
+   *  @param kind Intrinsic that symname was classified as.
    */
   void run_intrinsic(
     const code_function_call2t &call,
     reachability_treet &art,
-    const std::string &symname);
+    const std::string &symname,
+    intrinsict kind);
 
   /**
    *  Run a builtin, something prefixed with __builtin.
    *  This looks through a set of builtin functions that are implemented in
    *  ESBMC, and calls the appropriate one.
    *  @param call Function call being performed.
-   *  @param symname Name of builtin we're calling.
+   *  @param kind Builtin that the callee was classified as.
    *  @return true if we handled the builtin
    */
-  bool
-  run_builtin(const code_function_call2t &call, const std::string &symname);
+  bool run_builtin(const code_function_call2t &call, intrinsict kind);
 
   /** Perform yield; forces a context switch point. */
   void intrinsic_yield(reachability_treet &arg);
@@ -42,6 +42,10 @@ reachability_treet::reachability_treet(
   schedule = options.get_bool_option("schedule");
   smt_during_symex = options.get_bool_option("smt-during-symex");
   por = !options.get_bool_option("no-por");
+  partition_worker = 0;
+  partition_workers = 1;
+  partition_depth = 0;
+  partition_branches = 0;
   main_thread_ended = false;
   target_template = std::move(target);
 }
@@ -53,6 +57,7 @@ void reachability_treet::setup_for_new_explore()
   execution_states.clear();
 
   has_complete_formula = false;
+  partition_branches = 0;
 
   execution_statet *s;
   if (schedule)
@@ -149,14 +154,54 @@ void reachability_treet::create_next_state()
 
 bool reachability_treet::step_next_state()
 {
-  next_thread_id = decide_ileave_direction(get_cur_state());
-  if (next_thread_id != get_cur_state().threads_state.size())
-  {
-    create_next_state();
-    return true;
-  }
+  next_thread_id = decide_partition_direction();
+  if (next_thread_id == get_cur_state().threads_state.size())
+    return false;
 
-  return false;
+  create_next_state();
+  return true;
+}
+
+void reachability_treet::set_partition(
+  unsigned worker,
+  unsigned num_workers,
+  unsigned depth)
+{
+  assert(worker < num_workers && depth > 0);
+  partition_worker = worker;
+  partition_workers = num_workers;
+  partition_depth = depth;
+  partition_branches = 0;
+}
+
+bool reachability_treet::skip_partition_branch()
+{
+  if (partition_workers <= 1 || execution_states.size() != partition_depth)
+    return false;
+
+  return partition_branches++ % partition_workers != partition_worker;
+}
+
+unsigned int reachability_treet::decide_partition_direction()
+{
+  // Switches left to other workers are marked as explored by
+  // decide_ileave_direction, so this loop terminates.
+  unsigned int tid;
+  do
+    tid = decide_ileave_direction(get_cur_state());
+  while (tid != get_cur_state().threads_state.size() &&
+         skip_partition_branch());
+
+  return tid;
+}
+
+bool reachability_treet::owns_current_formula() const
+{
+  // A trace that went below the partition depth passed through a context
+  // switch this worker was assigned; shallower ones are all alike between
+  // workers and are checked by the first.
+  return partition_workers <= 1 ||
+         execution_states.size() > partition_depth || partition_worker == 0;
 }
 
 unsigned int
@@ -263,6 +308,9 @@ bool reachability_treet::reset_to_unexplored_state()
     // When backtracking, erase all the assertions from the equation before
     // continuing forwards. They've all already been checked, in the trace we
     // just backtracked from. Thus there's no point in checking them again.
+    // This also holds when the tree is partitioned: a trace this worker
+    // does not own is checked by the worker that does (see
+    // owns_current_formula).
     symex_target_equationt *eq =
       static_cast<symex_target_equationt *>((*cur_state_it)->target.get());
     unsigned int num_asserts = eq->clear_assertions();
@@ -561,7 +609,7 @@ goto_symext::symex_resultt reachability_treet::get_next_formula()
         break;
     }
 
-    next_thread_id = decide_ileave_direction(get_cur_state());
+    next_thread_id = decide_partition_direction();
 
     if (
       get_cur_state().interleaving_unviable &&
@@ -225,6 +225,27 @@ public:
    */
   goto_symext::symex_resultt generate_schedule_formula();
 
+  /**
+   *  Restrict exploration to one share of the interleavings.
+   *  Used to explore the reachability tree from several processes at once:
+   *  every worker runs the same deterministic DFS, but of the context switches
+   *  taken from execution states at the given depth, worker i only follows
+   *  those whose running count modulo num_workers equals i. The subtrees
+   *  below that depth are therefore split between the workers, and
+   *  interleavings that finish above it are left to worker 0.
+   *  @param worker Index of this worker, in [0, num_workers).
+   *  @param num_workers Number of workers sharing the tree.
+   *  @param depth Execution state stack depth at which to split.
+   */
+  void set_partition(unsigned worker, unsigned num_workers, unsigned depth);
+
+  /**
+   *  Whether the trace just generated belongs to this worker.
+   *  Always true unless set_partition was used.
+   *  @return True if the current formula should be checked by this worker.
+   */
+  bool owns_current_formula() const;
+
   /**
    *  Reset ex_state stack to unexplored state.
    *  This is just a wrapper around reset_to_unexplored_state
@@ -351,7 +372,7 @@ protected:
   /** Whether partial-order-reduction is enabled */
   bool por;
   /** Set of state hashes we've discovered */
-  std::set<crypto_hash> hit_hashes;
+  std::unordered_set<crypto_hash, crypto_hash_hash> hit_hashes;
   /** Flag as to whether we're picking interleaving directions explicitly.
    *  Corresponds to the --interactive-ileaves option. */
   bool interactive_ileaves;
@@ -359,6 +380,23 @@ protected:
   bool schedule;
   /** Are we using the --smt-during-symex method? */
   bool smt_during_symex;
+  /** This worker's index when the tree is partitioned, see set_partition */
+  unsigned int partition_worker;
+  /** Number of workers sharing the tree; 1 when not partitioned */
+  unsigned int partition_workers;
+  /** Execution state stack depth at which the tree is split */
+  unsigned int partition_depth;
+  /** Number of context switches considered so far at partition_depth */
+  uint64_t partition_branches;
+
+  /** Decide whether a context switch at the current depth is left to another
+   *  worker. Counts every switch considered at the partition depth. */
+  bool skip_partition_branch();
+
+  /** Decide the next context switch from the current state, passing over
+   *  those left to other workers.
+   *  @return Thread ID to switch to, or the number of threads if none. */
+  unsigned int decide_partition_direction();
 
   /* Map to store the expression and thread ID,
    * which that expression belongs to. */
@@ -186,7 +186,7 @@ void goto_symext::symex_function_call_code(const expr2tc &expr)
 
   // find code in function map
   goto_functionst::function_mapt::const_iterator it =
-    goto_functions.function_map.find(identifier);
+    goto_functions.find(identifier);
 
   if (it == goto_functions.function_map.end())
   {
@@ -409,7 +409,7 @@ void goto_symext::symex_function_call_deref(const expr2tc &expr)
   {
     const symbol2t &sym = to_symbol2t(it.second);
     goto_functionst::function_mapt::const_iterator fit =
-      goto_functions.function_map.find(sym.thename);
+      goto_functions.find(sym.thename);
 
     const std::string pretty_name = sym.thename.as_string().substr(
       sym.thename.as_string().find_last_of('@') + 1);
@@ -124,6 +124,11 @@ void goto_symext::symex_goto(const expr2tc &old_guard)
     }
   }
 
+  // Guards known to hold (e.g. decided by the interval analysis) need no
+  // state to be saved for the target
+  if (forward && new_guard_true && jump_forward(goto_target))
+    return;
+
   goto_programt::const_targett new_state_pc, state_pc;
 
   if (forward)
@@ -209,6 +214,61 @@ void goto_symext::symex_goto(const expr2tc &old_guard)
   }
 }
 
+bool goto_symext::jump_forward(goto_programt::const_targett goto_target)
+{
+  const statet::goto_state_mapt &goto_state_map =
+    cur_state->top().goto_state_map;
+
+  goto_programt::const_targett first = cur_state->source.pc;
+  ++first;
+
+  unsigned skipped = 0;
+  for (goto_programt::const_targett it = first; it != goto_target; ++it)
+  {
+    if (goto_state_map.count(it) != 0)
+      return false;
+
+    // Declarations and deaths are left to symex_step, which owns their L1
+    // renaming and --stack-limit bookkeeping
+    switch (it->type)
+    {
+    case SKIP:
+    case LOCATION:
+    case ASSIGN:
+    case ASSUME:
+    case ASSERT:
+    case GOTO:
+      ++skipped;
+      break;
+    default:
+      return false;
+    }
+  }
+
+  // Do what walking the instructions with a false guard would have done.
+  // The depth is left alone: merging at the target keeps the smaller one.
+  for (goto_programt::const_targett it = first; it != goto_target; ++it)
+  {
+    if (inductive_step && it->loop_number && !first_loop)
+      first_loop = it->loop_number;
+
+    if (it->is_backwards_goto())
+    {
+      cur_state->loop_iterations[it->loop_number] = 0;
+      if (it->loop_number == first_loop)
+        first_loop = 0;
+    }
+  }
+
+  log_debug(
+    "symex",
+    "Jumping over {} instructions to {}",
+    skipped,
+    goto_target->location.as_string());
+  cur_state->source.pc = goto_target;
+  return true;
+}
+
 static inline guardt merge_state_guards(
   goto_symext::statet::goto_statet &goto_state,
   goto_symex_statet &state)
@@ -351,7 +411,7 @@ void goto_symext::phi_function(const statet::goto_statet &goto_state)
     // changed!
     const symbolt &symbol = *ns.lookup(variable.base_name);
 
-    type2tc type = migrate_type(symbol.type);
+    const type2tc &type = ns.migrated_type(symbol);
 
     expr2tc cur_state_rhs = symbol2tc(type, symbol.id);
     renaming::level2t::rename_to_record(cur_state_rhs, variable);
@@ -376,8 +436,7 @@ void goto_symext::phi_function(const statet::goto_statet &goto_state)
       simplify(rhs);
     }
 
-    expr2tc lhs;
-    migrate_expr(symbol_expr(symbol), lhs);
+    expr2tc lhs = ns.migrated_symbol_expr(symbol);
     expr2tc new_lhs = lhs;
 
     // Again, specify which l1 data object we're going to make the assignment
@@ -310,17 +310,19 @@ void goto_symext::symex_step(reachability_treet &art)
     // unfortunate circumstance where a thread starts with false guard due to
     // decision taken in another thread in this trace. In that case the
     // terminate intrinsic _has_ to run, or we explode.
+    intrinsict kind = intrinsict::NONE;
     if (is_symbol2t(call.function))
     {
       const irep_idt &id = to_symbol2t(call.function).thename;
-      if (has_prefix(id.as_string(), "c:@F@__ESBMC"))
+      kind = classify_call(id);
+      if (is_esbmc_intrinsic(kind))
       {
         cur_state->source.pc++;
-        run_intrinsic(call, art, id.as_string());
+        run_intrinsic(call, art, id.as_string(), kind);
         return;
       }
 
-      if (id == "c:@F@scanf" || id == "c:@F@sscanf" || id == "c:@F@fscanf")
+      if (kind == intrinsict::SCANF)
       {
         cur_state->source.pc++;
 
@@ -339,15 +341,11 @@ void goto_symext::symex_step(reachability_treet &art)
       break;
     }
 
-    if (is_symbol2t(call.function))
+    if (is_builtin_intrinsic(kind))
     {
-      const irep_idt &id = to_symbol2t(call.function).thename;
-      if (has_prefix(id.as_string(), "c:@F@__builtin"))
-      {
-        cur_state->source.pc++;
-        if (run_builtin(call, id.as_string()))
-          return;
-      }
+      cur_state->source.pc++;
+      if (run_builtin(call, kind))
+        return;
     }
 
     symex_function_call(deref_code);
@@ -456,114 +454,182 @@ void goto_symext::symex_assert()
   claim(tmp, msg);
 }
 
+static goto_symext::intrinsict classify_call_name(const std::string &symname)
+{
+  typedef goto_symext::intrinsict intrinsict;
+
+  if (
+    symname == "c:@F@scanf" || symname == "c:@F@sscanf" ||
+    symname == "c:@F@fscanf")
+    return intrinsict::SCANF;
+
+  if (has_prefix(symname, "c:@F@__builtin"))
+  {
+    if (
+      has_prefix(symname, "c:@F@__builtin_sadd") ||
+      has_prefix(symname, "c:@F@__builtin_uadd"))
+      return intrinsict::BUILTIN_ADD_OVERFLOW;
+    if (
+      has_prefix(symname, "c:@F@__builtin_ssub") ||
+      has_prefix(symname, "c:@F@__builtin_usub"))
+      return intrinsict::BUILTIN_SUB_OVERFLOW;
+    if (
+      has_prefix(symname, "c:@F@__builtin_smul") ||
+      has_prefix(symname, "c:@F@__builtin_umul"))
+      return intrinsict::BUILTIN_MUL_OVERFLOW;
+    if (has_prefix(symname, "c:@F@__builtin_constant_p"))
+      return intrinsict::BUILTIN_CONSTANT_P;
+    return intrinsict::BUILTIN_OTHER;
+  }
+
+  if (!has_prefix(symname, "c:@F@__ESBMC"))
+    return intrinsict::NONE;
+
+  // Exact names first, then the families matched by prefix (they carry
+  // type-specific suffixes).
+  static const std::unordered_map<std::string, intrinsict> exact = {
+    {"c:@F@__ESBMC_yield", intrinsict::YIELD},
+    {"c:@F@__ESBMC_switch_to", intrinsict::SWITCH_TO},
+    {"c:@F@__ESBMC_switch_away_from", intrinsict::SWITCH_AWAY_FROM},
+    {"c:@F@__ESBMC_set_thread_internal_data",
+     intrinsict::SET_THREAD_INTERNAL_DATA},
+    {"c:@F@__ESBMC_get_thread_internal_data",
+     intrinsict::GET_THREAD_INTERNAL_DATA},
+    {"c:@F@__ESBMC_spawn_thread", intrinsict::SPAWN_THREAD},
+    {"c:@F@__ESBMC_terminate_thread", intrinsict::TERMINATE_THREAD},
+    {"c:@F@__ESBMC_get_thread_state", intrinsict::GET_THREAD_STATE},
+    {"c:@F@__ESBMC_really_atomic_begin", intrinsict::REALLY_ATOMIC_BEGIN},
+    {"c:@F@__ESBMC_really_atomic_end", intrinsict::REALLY_ATOMIC_END},
+    {"c:@F@__ESBMC_switch_to_monitor", intrinsict::SWITCH_TO_MONITOR},
+    {"c:@F@__ESBMC_switch_from_monitor", intrinsict::SWITCH_FROM_MONITOR},
+    {"c:@F@__ESBMC_register_monitor", intrinsict::REGISTER_MONITOR},
+    {"c:@F@__ESBMC_kill_monitor", intrinsict::KILL_MONITOR},
+    {"c:@F@__ESBMC_memset", intrinsict::MEMSET},
+    {"c:@F@__ESBMC_get_object_size", intrinsict::GET_OBJECT_SIZE},
+    {"c:@F@__ESBMC_no_abnormal_memory_leak",
+     intrinsict::NO_ABNORMAL_MEMORY_LEAK},
+    {"c:@F@__ESBMC_builtin_constant_p", intrinsict::ESBMC_CONSTANT_P},
+    {"c:@F@__ESBMC_bitcast", intrinsict::BITCAST},
+    {"c:@F@__ESBMC_unreachable", intrinsict::UNREACHABLE}};
+
+  auto it = exact.find(symname);
+  if (it != exact.end())
+    return it->second;
+
+  static const std::pair<const char *, intrinsict> prefixes[] = {
+    {"c:@F@__ESBMC_get_thread_id", intrinsict::GET_THREAD_ID},
+    {"c:@F@__ESBMC_convertvector", intrinsict::CONVERTVECTOR},
+    {"c:@F@__ESBMC_shufflevector", intrinsict::SHUFFLEVECTOR},
+    {"c:@F@__ESBMC_atomic_load", intrinsict::ATOMIC_LOAD},
+    {"c:@F@__ESBMC_atomic_store", intrinsict::ATOMIC_STORE},
+    {"c:@F@__ESBMC_is_little_endian", intrinsict::IS_LITTLE_ENDIAN},
+    {"c:@F@__ESBMC_init_object", intrinsict::INIT_OBJECT},
+    {"c:@F@__ESBMC_memory_leak_checks", intrinsict::MEMORY_LEAK_CHECKS},
+    {"c:@F@__ESBMC_pthread_start_main_hook", intrinsict::BUMP_CALL},
+    {"c:@F@__ESBMC_pthread_end_main_hook", intrinsict::BUMP_CALL},
+    {"c:@F@__ESBMC_atexit_handler", intrinsict::BUMP_CALL}};
+
+  for (const auto &[prefix, kind] : prefixes)
+    if (has_prefix(symname, prefix))
+      return kind;
+
+  return intrinsict::UNKNOWN_ESBMC;
+}
+
+goto_symext::intrinsict goto_symext::classify_call(const irep_idt &id)
+{
+  // Dense table indexed by the dstring number of the callee. Entries hold
+  // the intrinsic kind plus one, so that zero means "not classified yet".
+  static std::vector<unsigned char> cache;
+
+  unsigned no = id.get_no();
+  if (no >= cache.size())
+    cache.resize(no + 1 + no / 2, 0);
+
+  unsigned char &entry = cache[no];
+  if (entry == 0)
+    entry = static_cast<unsigned char>(classify_call_name(id.as_string())) + 1;
+
+  return static_cast<intrinsict>(entry - 1);
+}
+
 void goto_symext::run_intrinsic(
   const code_function_call2t &func_call,
   reachability_treet &art,
-  const std::string &symname)
+  const std::string &symname,
+  intrinsict kind)
 {
-  if (symname == "c:@F@__ESBMC_yield")
+  switch (kind)
   {
+  case intrinsict::YIELD:
     intrinsic_yield(art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_switch_to")
-  {
+  case intrinsict::SWITCH_TO:
     intrinsic_switch_to(func_call, art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_switch_away_from")
-  {
+  case intrinsict::SWITCH_AWAY_FROM:
     intrinsic_switch_from(art);
     return;
-  }
 
-  if (has_prefix(symname, "c:@F@__ESBMC_get_thread_id"))
-  {
+  case intrinsict::GET_THREAD_ID:
     intrinsic_get_thread_id(func_call, art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_set_thread_internal_data")
-  {
+  case intrinsict::SET_THREAD_INTERNAL_DATA:
     intrinsic_set_thread_data(func_call, art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_get_thread_internal_data")
-  {
+  case intrinsict::GET_THREAD_INTERNAL_DATA:
     intrinsic_get_thread_data(func_call, art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_spawn_thread")
-  {
+  case intrinsict::SPAWN_THREAD:
     intrinsic_spawn_thread(func_call, art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_terminate_thread")
-  {
+  case intrinsict::TERMINATE_THREAD:
     intrinsic_terminate_thread(art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_get_thread_state")
-  {
+  case intrinsict::GET_THREAD_STATE:
     intrinsic_get_thread_state(func_call, art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_really_atomic_begin")
-  {
+  case intrinsict::REALLY_ATOMIC_BEGIN:
     intrinsic_really_atomic_begin(art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_really_atomic_end")
-  {
+  case intrinsict::REALLY_ATOMIC_END:
     intrinsic_really_atomic_end(art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_switch_to_monitor")
-  {
+  case intrinsict::SWITCH_TO_MONITOR:
     intrinsic_switch_to_monitor(art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_switch_from_monitor")
-  {
+  case intrinsict::SWITCH_FROM_MONITOR:
     intrinsic_switch_from_monitor(art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_register_monitor")
-  {
+  case intrinsict::REGISTER_MONITOR:
     intrinsic_register_monitor(func_call, art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_kill_monitor")
-  {
+  case intrinsict::KILL_MONITOR:
     intrinsic_kill_monitor(art);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_memset")
-  {
+  case intrinsict::MEMSET:
     intrinsic_memset(art, func_call);
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_get_object_size")
-  {
+  case intrinsict::GET_OBJECT_SIZE:
     intrinsic_get_object_size(func_call, art);
     return;
-  }
 
-  if (has_prefix(symname, "c:@F@__ESBMC_convertvector"))
+  case intrinsict::CONVERTVECTOR:
   {
     assert(
       func_call.operands.size() == 1 &&
@@ -597,7 +663,7 @@ void goto_symext::run_intrinsic(
     return;
   }
 
-  if (has_prefix(symname, "c:@F@__ESBMC_shufflevector"))
+  case intrinsict::SHUFFLEVECTOR:
   {
     assert(
       func_call.operands.size() >= 2 &&
@@ -642,7 +708,7 @@ void goto_symext::run_intrinsic(
     return;
   }
 
-  if (has_prefix(symname, "c:@F@__ESBMC_atomic_load"))
+  case intrinsict::ATOMIC_LOAD:
   {
     assert(
       func_call.operands.size() == 3 && "Wrong __ESBMC_atomic_load signature");
@@ -659,7 +725,7 @@ void goto_symext::run_intrinsic(
     return;
   }
 
-  if (has_prefix(symname, "c:@F@__ESBMC_atomic_store"))
+  case intrinsict::ATOMIC_STORE:
   {
     assert(
       func_call.operands.size() == 3 && "Wrong __ESBMC_atomic_store signature");
@@ -673,9 +739,10 @@ void goto_symext::run_intrinsic(
     symex_assign(code_assign2tc(
       dereference2tc(to_pointer_type(ptr->type).subtype, ptr),
       dereference2tc(to_pointer_type(ret->type).subtype, ret)));
+    return;
   }
 
-  if (has_prefix(symname, "c:@F@__ESBMC_is_little_endian"))
+  case intrinsict::IS_LITTLE_ENDIAN:
   {
     expr2tc is_little_endian =
       (config.ansi_c.endianess == configt::ansi_ct::IS_LITTLE_ENDIAN)
@@ -684,7 +751,8 @@ void goto_symext::run_intrinsic(
     symex_assign(code_assign2tc(func_call.ret, is_little_endian));
     return;
   }
-  else if (symname == "c:@F@__ESBMC_no_abnormal_memory_leak")
+
+  case intrinsict::NO_ABNORMAL_MEMORY_LEAK:
   {
     expr2tc no_abnormal_memleak =
       config.options.get_bool_option("no-abnormal-memory-leak")
@@ -694,7 +762,7 @@ void goto_symext::run_intrinsic(
     return;
   }
 
-  if (symname == "c:@F@__ESBMC_builtin_constant_p")
+  case intrinsict::ESBMC_CONSTANT_P:
   {
     assert(
       func_call.operands.size() == 1 &&
@@ -711,7 +779,7 @@ void goto_symext::run_intrinsic(
     return;
   }
 
-  if (has_prefix(symname, "c:@F@__ESBMC_init_object"))
+  case intrinsict::INIT_OBJECT:
   {
     assert(
       func_call.operands.size() == 1 && "Wrong __ESBMC_init_object signature");
@@ -762,13 +830,11 @@ void goto_symext::run_intrinsic(
     return;
   }
 
-  if (has_prefix(symname, "c:@F@__ESBMC_memory_leak_checks"))
-  {
+  case intrinsict::MEMORY_LEAK_CHECKS:
     add_memory_leak_checks();
     return;
-  }
 
-  if (symname == "c:@F@__ESBMC_bitcast")
+  case intrinsict::BITCAST:
   {
     assert(func_call.operands.size() == 2 && "Wrong __ESBMC_bitcast signature");
     expr2tc tgtptr = func_call.operands[0];
@@ -792,23 +858,20 @@ void goto_symext::run_intrinsic(
     return;
   }
 
-  if (symname == "c:@F@__ESBMC_unreachable")
-  {
+  case intrinsict::UNREACHABLE:
     if (options.get_bool_option("enable-unreachability-intrinsic"))
       claim(
         not2tc(cur_state->guard.as_expr()),
         "reachability: unreachable code reached");
     return;
-  }
 
   // We simply call these functions
-  if (
-    has_prefix(symname, "c:@F@__ESBMC_pthread_start_main_hook") ||
-    has_prefix(symname, "c:@F@__ESBMC_pthread_end_main_hook") ||
-    has_prefix(symname, "c:@F@__ESBMC_atexit_handler"))
-  {
+  case intrinsict::BUMP_CALL:
     bump_call(func_call, symname);
     return;
+
+  default:
+    break;
   }
 
   log_error(
@@ -960,7 +1023,7 @@ void goto_symext::add_memory_leak_checks()
             i,
             e.identifier,
             e.suffix);
-          sym_expr2->type = migrate_type(sym->type);
+          sym_expr2->type = ns.migrated_type(*sym);
 
           /* Rename so that it reflects the current state. */
           assert(cur_state->call_stack.size() >= 1);
@@ -24,7 +24,7 @@ void goto2ct::preprocess()
 void goto2ct::preprocess(goto_functionst &goto_functions)
 {
   // Remove ESBMC main first
-  goto_functions.function_map.erase("__ESBMC_main");
+  goto_functions.erase("__ESBMC_main");
   // Iterating through all GOTO functions
   for (auto it = goto_functions.function_map.begin();
        it != goto_functions.function_map.end();)
@@ -37,7 +37,7 @@ void goto2ct::preprocess(goto_functionst &goto_functions)
     }
     // Remove the function otherwise
     else
-      goto_functions.function_map.erase(it++);
+      it = goto_functions.erase(it);
   }
 }
 
@@ -132,16 +132,16 @@ void jimple_languaget::setup_main(contextt &context)
   // find main symbol
   std::list<irep_idt> matches;
 
-  forall_symbol_base_map (it, context.symbol_base_map, main)
+  forall_symbol_base_map (id, context.symbol_base_map, main)
   {
     // look it up
-    symbolt *s = context.find_symbol(it->second);
+    symbolt *s = context.find_symbol(id);
 
     if (s == nullptr)
       continue;
 
     if (s->type.is_code())
-      matches.push_back(it->second);
+      matches.push_back(id);
   }
   if (matches.empty())
     abort();
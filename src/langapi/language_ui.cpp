@@ -32,22 +32,47 @@ language_uit &language_uit::operator=(language_uit &&o) noexcept
 
 bool language_uit::parse(const cmdlinet &cmdline)
 {
+  /* Hand consecutive files of the same language to its frontend at once, so
+   * that it may process them concurrently. Files are still parsed in their
+   * order on the command line. */
+  std::vector<std::pair<language_idt, std::vector<std::string>>> batches;
+
   for (const auto &arg : cmdline.args)
   {
-    if (parse(arg))
+    language_idt lang;
+    if (!frontend_for(arg, lang))
+      return true;
+
+    if (batches.empty() || batches.back().first != lang)
+      batches.emplace_back(lang, std::vector<std::string>());
+    batches.back().second.push_back(arg);
+  }
+
+  for (const auto &[lang, files] : batches)
+  {
+    config.language.lid = lang;
+
+    for (const std::string &file : files)
+      log_progress("Parsing {}", file);
+
+    if (langmap.at(lang)->parse_files(files))
+    {
+      log_error("PARSING ERROR");
       return true;
+    }
   }
 
   return false;
 }
 
-bool language_uit::parse(const std::string &filename)
+languaget *
+language_uit::frontend_for(const std::string &filename, language_idt &lang)
 {
-  language_idt lang = language_id_by_path(filename);
+  lang = language_id_by_path(filename);
   if (lang == language_idt::NONE)
   {
     log_error("failed to figure out type of file {}", filename);
-    return true;
+    return nullptr;
   }
 
   config.language.lid = lang;
@@ -57,11 +82,9 @@ bool language_uit::parse(const std::string &filename)
   if (!infile)
   {
     log_error("failed to open input file {}", filename);
-    return true;
+    return nullptr;
   }
 
-  log_progress("Parsing {}", filename);
-
   auto it = langmap.find(lang);
   if (it == langmap.end())
   {
@@ -76,10 +99,22 @@ bool language_uit::parse(const std::string &filename)
       "{}frontend for {} was not built on this version of ESBMC",
       config.options.get_bool_option("old-frontend") ? "old-" : "",
       language_name(lang));
-    return true;
+    return nullptr;
   }
 
-  if (it->second->parse(filename))
+  return it->second.get();
+}
+
+bool language_uit::parse(const std::string &filename)
+{
+  language_idt lang;
+  languaget *frontend = frontend_for(filename, lang);
+  if (!frontend)
+    return true;
+
+  log_progress("Parsing {}", filename);
+
+  if (frontend->parse(filename))
   {
     log_error("PARSING ERROR");
     return true;
@@ -31,6 +31,10 @@ public:
   virtual void show_symbol_table_xml_ui();
 
 protected:
+  /* Checks `filename` and sets up the frontend for its language, which is
+   * stored in `lang`. Returns nullptr on error. */
+  languaget *frontend_for(const std::string &filename, language_idt &lang);
+
   /* The instance of this class manages the global migrate_namespace_lookup,
    * thus it cannot be copied. These functions are protected in order for
    * derived classes to opt-into move support. */
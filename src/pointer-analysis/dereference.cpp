@@ -1,4 +1,5 @@
 #include <cassert>
+#include <numeric>
 #include <langapi/language_util.h>
 #include <pointer-analysis/dereference.h>
 #include <pointer-analysis/value_set.h>
@@ -612,6 +613,43 @@ bool dereferencet::dereference_type_compare(
   return false;
 }
 
+/// Largest power of two known to divide every value of the offset e, in
+/// bits, or 0 if e is always 0
+static unsigned int offset_alignment(const expr2tc &e)
+{
+  const unsigned int max_alignment = 1u << 30;
+
+  if (is_constant_int2t(e))
+  {
+    const BigInt &v = to_constant_int2t(e).value;
+    if (v.is_zero())
+      return 0;
+    if (!v.is_uint64())
+      return 1;
+    uint64_t u = v.to_uint64();
+    return std::min<uint64_t>(u & -u, max_alignment);
+  }
+
+  if (is_typecast2t(e))
+    return offset_alignment(to_typecast2t(e).from);
+
+  if (is_add2t(e) || is_sub2t(e))
+    return std::gcd(
+      offset_alignment(*e->get_sub_expr(0)),
+      offset_alignment(*e->get_sub_expr(1)));
+
+  if (is_mul2t(e))
+  {
+    uint64_t a = offset_alignment(to_mul2t(e).side_1);
+    uint64_t b = offset_alignment(to_mul2t(e).side_2);
+    if (a == 0 || b == 0)
+      return 0;
+    return std::min<uint64_t>(a * b, max_alignment);
+  }
+
+  return 1;
+}
+
 expr2tc dereferencet::build_reference_to(
   const expr2tc &what,
   modet mode,
@@ -759,6 +797,11 @@ expr2tc dereferencet::build_reference_to(
   // Converting alignment to bits here
   alignment *= 8;
 
+  // The alignment is the one of the pointer, an offset added lexically (like
+  // the one of the member in p->b) need not be a multiple of it
+  if (alignment != 0 && !is_nil_expr(lexical_offset))
+    alignment = std::gcd(alignment, offset_alignment(lexical_offset));
+
   // Call reference building methods. For the given data object in value,
   // an expression of type type will be constructed that reads from it.
   build_reference_rec(value, final_offset, type, tmp_guard, mode, alignment);
@@ -1346,7 +1389,8 @@ void dereferencet::construct_from_dyn_struct_offset(
   const guardt &guard,
   unsigned long alignment,
   modet mode,
-  const expr2tc *failed_symbol)
+  const expr2tc *failed_symbol,
+  const std::vector<BigInt> *feasible_offsets)
 {
   unsigned int access_sz = type_byte_size_bits(type).to_uint64();
 
@@ -1372,6 +1416,22 @@ void dereferencet::construct_from_dyn_struct_offset(
   else
     failed_container = *failed_symbol;
 
+  // If the offset is known to be aligned, it can only take a few values
+  // inside this struct. Enumerate them so that fields which no such offset
+  // falls into are skipped entirely, and fields hit at a single offset get
+  // an equality guard instead of a range.
+  std::vector<BigInt> aligned_offsets;
+  if (feasible_offsets == nullptr && alignment >= config.ansi_c.char_width)
+  {
+    BigInt struct_size = type_byte_size_bits(value->type, &ns);
+    if (struct_size / alignment <= max_feasible_struct_offsets)
+    {
+      for (BigInt o = 0; o < struct_size; o += alignment)
+        aligned_offsets.push_back(o);
+      feasible_offsets = &aligned_offsets;
+    }
+  }
+
   // A list of guards, and outcomes. The result should be a gigantic
   // if-then-else chain based on those guards.
   std::list<std::pair<expr2tc, expr2tc>> extract_list;
@@ -1386,12 +1446,36 @@ void dereferencet::construct_from_dyn_struct_offset(
     it = ns.follow(it);
     BigInt field_size = type_byte_size_bits(it, &ns);
 
+    // Offsets relative to this field that the access may start at
+    std::vector<BigInt> field_offsets;
+    if (feasible_offsets != nullptr)
+    {
+      for (const BigInt &o : *feasible_offsets)
+        if (o >= offs && o < offs + field_size)
+          field_offsets.push_back(o - offs);
+
+      if (field_offsets.empty())
+      {
+        i++;
+        continue;
+      }
+    }
+
     // Round up to word size
     expr2tc field_offset = constant_int2tc(offset->type, offs);
-    expr2tc field_top = constant_int2tc(offset->type, offs + field_size);
-    expr2tc lower_bound = greaterthanequal2tc(bits_offset, field_offset);
-    expr2tc upper_bound = lessthan2tc(bits_offset, field_top);
-    expr2tc field_guard = and2tc(lower_bound, upper_bound);
+    expr2tc field_guard;
+    if (field_offsets.size() == 1)
+    {
+      expr2tc at = constant_int2tc(offset->type, offs + field_offsets.front());
+      field_guard = equality2tc(bits_offset, at);
+    }
+    else
+    {
+      expr2tc field_top = constant_int2tc(offset->type, offs + field_size);
+      expr2tc lower_bound = greaterthanequal2tc(bits_offset, field_offset);
+      expr2tc upper_bound = lessthan2tc(bits_offset, field_top);
+      field_guard = and2tc(lower_bound, upper_bound);
+    }
     expr2tc field = member2tc(it, value, struct_type.member_names[i]);
     expr2tc new_offset = sub2tc(offset->type, offset, field_offset);
     simplify(new_offset);
@@ -1400,7 +1484,14 @@ void dereferencet::construct_from_dyn_struct_offset(
     {
       // Handle recursive structs
       construct_from_dyn_struct_offset(
-        field, new_offset, type, guard, alignment, mode, &failed_container);
+        field,
+        new_offset,
+        type,
+        guard,
+        alignment,
+        mode,
+        &failed_container,
+        feasible_offsets != nullptr ? &field_offsets : nullptr);
       extract_list.emplace_back(field_guard, field);
     }
     else if (is_array_type(it))
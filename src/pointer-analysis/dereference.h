@@ -459,6 +459,11 @@ public:
     unsigned long alignment = 0);
 
 private:
+  /** Largest number of aligned offsets into a struct that
+   *  construct_from_dyn_struct_offset enumerates instead of falling back to
+   *  range guards over every field. */
+  static const constexpr unsigned max_feasible_struct_offsets = 64;
+
   void construct_from_const_offset(
     expr2tc &value,
     const expr2tc &offset,
@@ -480,7 +485,8 @@ private:
     const guardt &guard,
     unsigned long alignment,
     modet mode,
-    const expr2tc *failed_symbol = nullptr);
+    const expr2tc *failed_symbol = nullptr,
+    const std::vector<BigInt> *feasible_offsets = nullptr);
   void construct_from_multidir_array(
     expr2tc &value,
     const expr2tc &offset,
@@ -18,11 +18,29 @@ import base64
 from preprocessor import Preprocessor
 
 
+# Source files read outside of the output directory
+source_files = []
+
+
 def check_usage():
     if len(sys.argv) != 3:
         print("Usage: python astgen.py <file path> <output directory>")
         sys.exit(2)
 
+def record_source(filename, output_dir):
+    path = os.path.abspath(filename)
+    if not path.startswith(os.path.abspath(output_dir) + os.sep):
+        source_files.append(path)
+
+def write_sources(output_dir):
+    """
+    Write the list of source files the JSON files were generated from, used
+    by ESBMC to tell whether a cached copy of the output is still valid.
+    """
+    with open(os.path.join(output_dir, "sources.txt"), "w") as sources:
+        for path in sorted(set(source_files)):
+            sources.write(path + "\n")
+
 def is_imported_model(module_name):
     models = ["math", "os"]
     return module_name in models
@@ -91,6 +109,7 @@ def process_imports(node, output_dir, imported_modules):
     # Generate JSON file for imported elements
     try:
         with open(filename, "r") as source:
+            record_source(filename, output_dir)
             tree = ast.parse(source.read())
             generate_ast_json(tree, filename, imported_elements, output_dir)
     except UnicodeDecodeError:
@@ -179,6 +198,7 @@ def detect_and_process_submodules(node, imported_modules, output_dir):
 
                     try:
                         with open(filename, "r") as source:
+                            record_source(filename, output_dir)
                             tree = ast.parse(source.read())
                             generate_ast_json(tree, filename, None, output_dir + "/" + module_name)
                     except UnicodeDecodeError:
@@ -198,6 +218,7 @@ def main():
 
     # Process and convert AST for main file
     with open(filename, "r") as source:
+        record_source(filename, output_dir)
         tree = ast.parse(source.read())
 
     # Apply AST transformations
@@ -237,6 +258,8 @@ def main():
             # Generate JSON from AST for the memory models.
             generate_ast_json(model_tree, filename, None, output_dir)
 
+    write_sources(output_dir)
+
 
 if __name__ == "__main__":
     main()
@@ -6,10 +6,13 @@
 #include <util/message.h>
 #include <util/filesystem.h>
 #include <util/c_expr2string.h>
+#include <util/content_hash.h>
 #include <c2goto/cprover_library.h>
+#include <ac_config.h>
 
 #include <cstdlib>
 #include <fstream>
+#include <sstream>
 
 #include <boost/filesystem.hpp>
 #include <boost/process.hpp>
@@ -23,19 +26,12 @@ extern "C"
 #undef ESBMC_FLAIL
 }
 
-// TODO: Rename this function as it is dumping other files now.
-static const std::string &dump_python_script()
+// Dump all Python (.py) files from src/python-frontend into `dir`
+static void dump_python_files(const fs::path &dir)
 {
-  // Dump all Python (.py) files from src/python-frontend into a temporary directory
-  static bool dumped = false;
-  static auto p =
-    file_operations::create_tmp_dir("esbmc-python-astgen-%%%%-%%%%-%%%%");
-  if (!dumped)
-  {
-    dumped = true;
 #define ESBMC_FLAIL(body, size, ...)                                           \
   {                                                                            \
-    fs::path filePath(fs::path(p.path()) / #__VA_ARGS__);                      \
+    fs::path filePath(dir / #__VA_ARGS__);                                     \
     fs::path directory = filePath.parent_path();                               \
     if (!directory.empty() && !fs::exists(directory))                          \
       fs::create_directories(directory);                                       \
@@ -44,6 +40,18 @@ static const std::string &dump_python_script()
 
 #include <pythonastgen.h>
 #undef ESBMC_FLAIL
+}
+
+// TODO: Rename this function as it is dumping other files now.
+static const std::string &dump_python_script()
+{
+  static bool dumped = false;
+  static auto p =
+    file_operations::create_tmp_dir("esbmc-python-astgen-%%%%-%%%%-%%%%");
+  if (!dumped)
+  {
+    dumped = true;
+    dump_python_files(p.path());
   }
   return p.path();
 }
@@ -53,20 +61,18 @@ languaget *new_python_language()
   return new python_languaget;
 }
 
-bool python_languaget::parse(const std::string &path)
+/* Runs parser.py from `scripts_dir` over `path`, writing the JSON files into
+ * `output_dir`. Returns the exit status of parser.py. */
+static int run_parser(
+  const std::string &scripts_dir,
+  const std::string &path,
+  const std::string &output_dir)
 {
-  log_debug("python", "Parsing: {}", path);
-
-  fs::path script(path);
-  if (!fs::exists(script))
-    return true;
-
-  ast_output_dir = dump_python_script();
-  fs::path parser_path(ast_output_dir);
+  fs::path parser_path(scripts_dir);
   parser_path /= "parser.py";
 
   // Execute Python script to generate JSON file from AST
-  std::vector<std::string> args = {parser_path.string(), path, ast_output_dir};
+  std::vector<std::string> args = {parser_path.string(), path, output_dir};
 
   // Get Python interpreter path informed by the user
   std::string python_exec = config.options.get_option("python");
@@ -79,9 +85,128 @@ bool python_languaget::parse(const std::string &path)
   // Wait for execution
   process.wait();
 
-  // parser.py execution failed
-  if (process.exit_code())
-    exit(process.exit_code());
+  return process.exit_code();
+}
+
+/* Returns the directory holding the JSON files parser.py generates for
+ * `path`, reusing the ones cached in `cache_dir` by an earlier run. Entries
+ * are keyed by the ESBMC version, the Python interpreter, the bundled
+ * scripts and models and the path and contents of the input, and are only
+ * reused while none of the modules the input imports have changed.
+ *
+ * Each key is a directory holding generations of the entry and a file
+ * `current` naming the complete one to use. A generation is never modified
+ * once `current` names it, and `current` is only ever replaced by a rename,
+ * so processes sharing the cache always find a complete entry. Generations
+ * superseded after an import changed are left for the readers that may
+ * still be using them; removing the cache directory reclaims them. */
+static std::string
+cached_python_ast_dir(const std::string &cache_dir, const std::string &path)
+{
+  using content_hash::hash_string;
+
+  std::string input;
+  if (content_hash::read_file(path, input))
+  {
+    const std::string &dir = dump_python_script();
+    if (int status = run_parser(dir, path, dir))
+      exit(status);
+    return dir;
+  }
+
+  crypto_hash h;
+  hash_string(h, ESBMC_VERSION);
+  hash_string(h, config.options.get_option("python"));
+#define ESBMC_FLAIL(body, size, ...)                                           \
+  hash_string(h, #__VA_ARGS__);                                                \
+  h.ingest(body, size);
+
+#include <pythonastgen.h>
+#undef ESBMC_FLAIL
+  hash_string(h, fs::absolute(path).string());
+  hash_string(h, input);
+  h.fin();
+
+  fs::path key = fs::absolute(cache_dir) / h.to_string();
+  fs::path current = key / "current";
+  std::string generation;
+  if (!content_hash::read_file(current.string(), generation))
+  {
+    fs::path entry = key / generation;
+    std::string deps_path = (entry / "deps").string();
+    if (
+      !generation.empty() && fs::is_directory(entry) &&
+      content_hash::dependencies_unchanged(deps_path))
+    {
+      log_debug("python", "reusing cached AST {}", entry.string());
+      return entry.string();
+    }
+  }
+
+  boost::system::error_code ec;
+  fs::create_directories(key, ec);
+
+  // The new generation has a name of its own, nobody else uses it until it
+  // is published through `current`
+  fs::path entry = fs::unique_path(key / "%%%%-%%%%-%%%%");
+  dump_python_files(entry);
+  if (int status = run_parser(entry.string(), path, entry.string()))
+  {
+    // parser.py execution failed: do not leave the partial entry behind
+    fs::remove_all(entry, ec);
+    exit(status);
+  }
+
+  std::ifstream sources((entry / "sources.txt").string());
+  std::ofstream deps((entry / "deps").string());
+  std::string source;
+  bool ok = sources.good();
+  while (ok && std::getline(sources, source))
+    ok = !content_hash::write_dependency(deps, source);
+  deps.close();
+  ok = ok && deps && !sources.bad();
+
+  if (ok)
+  {
+    // Publish the generation, replacing any stale one in a single rename
+    fs::path tmp = fs::unique_path(key / "current-%%%%-%%%%");
+    std::ofstream name(tmp.string());
+    name << entry.filename().string();
+    name.close();
+    if (name)
+      fs::rename(tmp, current, ec);
+    if (name && !ec)
+      return entry.string();
+    fs::remove(tmp, ec);
+  }
+
+  log_warning("failed to update the Python AST cache");
+  fs::remove_all(entry, ec);
+
+  const std::string &dir = dump_python_script();
+  if (int status = run_parser(dir, path, dir))
+    exit(status);
+  return dir;
+}
+
+bool python_languaget::parse(const std::string &path)
+{
+  log_debug("python", "Parsing: {}", path);
+
+  fs::path script(path);
+  if (!fs::exists(script))
+    return true;
+
+  const std::string cache_dir = config.options.get_option("python-ast-cache");
+  if (!cache_dir.empty())
+    ast_output_dir = cached_python_ast_dir(cache_dir, path);
+  else
+  {
+    ast_output_dir = dump_python_script();
+    // parser.py execution failed
+    if (int status = run_parser(ast_output_dir, path, ast_output_dir))
+      exit(status);
+  }
 
   std::stringstream script_path;
   script_path << ast_output_dir << "/" << script.stem().string() << ".json";
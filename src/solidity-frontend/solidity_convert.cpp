@@ -39,6 +39,30 @@ solidity_convertert::solidity_convertert(
     (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
 }
 
+const std::unordered_set<std::string> solidity_convertert::unused_keys = {
+  "baseFunctions",
+  "documentation",
+  "functionSelector",
+  "isConstant",
+  "isLValue",
+  "isPure",
+  "lValueRequested",
+  "license",
+  "modifiers",
+  "overloadedDeclarations",
+  "overrides",
+  "storageLocation"};
+
+nlohmann::json solidity_convertert::parse_json_block(const std::string &block)
+{
+  return nlohmann::json::parse(
+    block,
+    [](int, nlohmann::json::parse_event_t event, nlohmann::json &parsed) {
+      return event != nlohmann::json::parse_event_t::key ||
+             !unused_keys.count(parsed.get_ref<const std::string &>());
+    });
+}
+
 bool solidity_convertert::convert()
 {
   // This function consists of two parts:
@@ -213,7 +237,6 @@ void solidity_convertert::multi_json_file()
   for (auto &ast_json : src_ast_json_array)
   {
     std::string path = ast_json["absolutePath"];
-    path_to_json[path] = ast_json;
     std::unordered_set<std::string> imports;
     // Extract the import path from the ImportDirective node.
     for (const auto &node : ast_json["nodes"])
@@ -225,6 +248,7 @@ void solidity_convertert::multi_json_file()
       }
     }
     import_graph[path] = imports;
+    path_to_json[path] = std::move(ast_json);
   }
 
   // Perform topological sorting
@@ -232,10 +256,12 @@ void solidity_convertert::multi_json_file()
     topological_sort(import_graph, path_to_json);
 
   // Update order of src_ast_json_array
-  src_ast_json_array = sorted_json_files;
+  src_ast_json_array = nlohmann::json::array();
+  for (nlohmann::json &json_file : sorted_json_files)
+    src_ast_json_array.push_back(std::move(json_file));
 
   // src_ast_json_array[0] means the .sol file that is being verified and not being imported.
-  src_ast_json = src_ast_json_array[0];
+  src_ast_json = std::move(src_ast_json_array[0]);
 
   // The initial part of the nodes in a single AST includes an import information description section
   // and a version description section. This is followed by all the information that needs to be verified.
@@ -255,7 +281,7 @@ void solidity_convertert::multi_json_file()
   {
     nlohmann::json &imported_part = src_ast_json_array[i];
     // Traverse nodes in the imported part
-    for (const auto &node : imported_part["nodes"])
+    for (auto &node : imported_part["nodes"])
     {
       if (
         node["nodeType"] == "ContractDefinition" &&
@@ -267,7 +293,7 @@ void solidity_convertert::multi_json_file()
         // into multiple files results in the import order of contracts and interfaces in the AST file
         // being reversed compared to the unsplit version.
         src_ast_json["nodes"].insert(
-          src_ast_json["nodes"].begin() + insert_pos, node);
+          src_ast_json["nodes"].begin() + insert_pos, std::move(node));
         ++insert_pos; // Adjust the insert position for the next node
       }
     }
@@ -313,7 +339,7 @@ std::vector<nlohmann::json> solidity_convertert::topological_sort(
     std::string node = zero_in_degree_queue.front();
     zero_in_degree_queue.pop();
     // add the node's corresponding JSON file to the sorted result
-    sorted_files.push_back(path_to_json[node]);
+    sorted_files.push_back(std::move(path_to_json[node]));
     // Update the in-degree of neighboring nodes and add the new node with in-degree 0 to the queue
     for (const auto &neighbor : graph[node])
     {
@@ -334,11 +360,12 @@ std::vector<nlohmann::json> solidity_convertert::topological_sort(
 bool solidity_convertert::convert_ast_nodes(const nlohmann::json &contract_def)
 {
   size_t index = 0;
-  nlohmann::json ast_nodes = contract_def["nodes"];
-  for (nlohmann::json::iterator itr = ast_nodes.begin(); itr != ast_nodes.end();
+  const nlohmann::json &ast_nodes = contract_def["nodes"];
+  for (nlohmann::json::const_iterator itr = ast_nodes.begin();
+       itr != ast_nodes.end();
        ++itr, ++index)
   {
-    nlohmann::json ast_node = *itr;
+    const nlohmann::json &ast_node = *itr;
     std::string node_name = ast_node["name"].get<std::string>();
     std::string node_type = ast_node["nodeType"].get<std::string>();
     log_debug(
@@ -2266,8 +2293,8 @@ bool solidity_convertert::get_expr(
       if (struct_ref == empty_json)
         return true;
 
-      const nlohmann::json members = struct_ref["members"];
-      const nlohmann::json args = expr["arguments"];
+      const nlohmann::json &members = struct_ref["members"];
+      const nlohmann::json &args = expr["arguments"];
 
       // populate components
       for (size_t i = 0; i < inits.operands().size() && i < args.size(); i++)
@@ -2577,7 +2604,7 @@ bool solidity_convertert::get_expr(
     // Function symbol id is sol:@C@referenced_function_contract_name@F@function_name#referenced_function_id
     // Using referencedDeclaration will point us to the original declared function. This works even for inherited function and overridden functions.
     assert(expr.contains("expression"));
-    const nlohmann::json callee_expr_json = expr["expression"];
+    const nlohmann::json &callee_expr_json = expr["expression"];
 
     const int caller_id = callee_expr_json["referencedDeclaration"].get<int>();
 
@@ -2652,7 +2679,7 @@ bool solidity_convertert::get_expr(
     // uint16 b = uint16(a); // b will be 0x2178 now
 
     assert(expr.contains("expression"));
-    const nlohmann::json conv_expr = expr["expression"];
+    const nlohmann::json &conv_expr = expr["expression"];
     typet type;
     exprt from_expr;
 
@@ -6054,7 +6081,7 @@ bool solidity_convertert::get_empty_array_ref(
 
   // 2. get array size
   exprt size;
-  const nlohmann::json literal_type = callee_arg_json["typeDescriptions"];
+  const nlohmann::json &literal_type = callee_arg_json["typeDescriptions"];
   if (get_expr(callee_arg_json, literal_type, size))
     return true;
 
@@ -6,6 +6,7 @@
 #include <vector>
 #include <map>
 #include <queue>
+#include <unordered_set>
 #include <util/context.h>
 #include <util/namespace.h>
 #include <util/std_types.h>
@@ -26,6 +27,14 @@ public:
 
   bool convert();
 
+  /* Parses one JSON block of solc's output. The properties listed in
+   * unused_keys are never read by the converter and are dropped while
+   * parsing, so that they are not held in memory for the rest of the run.
+   * A key must be removed from that list before any get_* method reads
+   * it. */
+  static nlohmann::json parse_json_block(const std::string &block);
+  static const std::unordered_set<std::string> unused_keys;
+
 protected:
   void multi_json_file();
   std::vector<nlohmann::json> topological_sort(
@@ -212,8 +221,9 @@ protected:
 
   contextt &context;
   namespacet ns;
-  // json for Solidity AST. Use vector for multiple contracts
-  nlohmann::json src_ast_json_array = nlohmann::json::array();
+  // json for Solidity AST. Use vector for multiple contracts. This is the
+  // frontend's own array, whose contents are moved into src_ast_json.
+  nlohmann::json &src_ast_json_array;
   // json for Solidity AST. Use object for single contract
   nlohmann::json src_ast_json;
   // Solidity function to be verified
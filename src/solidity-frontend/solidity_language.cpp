@@ -83,7 +83,6 @@ bool solidity_languaget::parse(const std::string &path)
   // Process AST json file
   std::ifstream ast_json_file_stream(path);
   std::string new_line;
-  std::vector<nlohmann::json> json_blocks;
   std::string current_json_block;
 
   // Skip the initial part until the first ".sol ======="
@@ -101,27 +100,25 @@ bool solidity_languaget::parse(const std::string &path)
     {
       if (!current_json_block.empty())
       {
-        json_blocks.push_back(nlohmann::json::parse(current_json_block));
+        src_ast_json_array.push_back(
+          solidity_convertert::parse_json_block(current_json_block));
         current_json_block.clear();
       }
     }
     else
     {
-      current_json_block += new_line + "\n";
+      current_json_block += new_line;
+      current_json_block += '\n';
     }
   }
 
   // Parse the last JSON block
   if (!current_json_block.empty())
   {
-    json_blocks.push_back(nlohmann::json::parse(current_json_block));
+    src_ast_json_array.push_back(
+      solidity_convertert::parse_json_block(current_json_block));
   }
 
-  // Combine all parsed JSON blocks into one JSON array
-  for (const auto &block : json_blocks)
-  {
-    src_ast_json_array.push_back(block);
-  }
   return false;
 }
 
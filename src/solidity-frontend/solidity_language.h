@@ -15,6 +15,12 @@ public:
 
   bool parse(const std::string &path) override;
 
+  // the inputs are not C, so they cannot go to clang_c_languaget at once
+  bool parse_files(const std::vector<std::string> &paths) override
+  {
+    return languaget::parse_files(paths);
+  }
+
   bool final(contextt &context) override;
 
   bool typecheck(contextt &context, const std::string &module) override;
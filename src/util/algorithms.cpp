@@ -7,28 +7,81 @@ bool goto_functions_algorithm::run(goto_functionst &goto_functions)
 {
   runOnProgram(goto_functions);
   Forall_goto_functions (it, goto_functions)
+    run_on_function(*it, goto_functions);
+  goto_functions.update();
+  return true;
+}
+
+void goto_functions_algorithm::run_on_function(
+  std::pair<const dstring, goto_functiont> &F,
+  goto_functionst &goto_functions)
+{
+  number_of_functions++;
+  runOnFunction(F);
+  if (!F.second.body_available || !visits_loops())
+    return;
+
+  goto_loopst goto_loops(F.first, goto_functions, F.second);
+  auto function_loops = goto_loops.get_loops();
+  number_of_loops += function_loops.size();
+  if (function_loops.size())
   {
-    number_of_functions++;
-    runOnFunction(*it);
-    if (it->second.body_available)
+    goto_programt &goto_program = F.second.body;
+
+    // Foreach loop in the function
+    for (auto itt = function_loops.rbegin(); itt != function_loops.rend();
+         ++itt)
+      runOnLoop(*itt, goto_program);
+  }
+}
+
+bool goto_function_pass_managert::run(goto_functionst &goto_functions)
+{
+  auto it = algorithms.cbegin();
+  while (it != algorithms.cend())
+  {
+    if (!(*it)->is_function_local())
     {
-      goto_loopst goto_loops(it->first, goto_functions, it->second);
-      auto function_loops = goto_loops.get_loops();
-      number_of_loops += function_loops.size();
-      if (function_loops.size())
-      {
-        goto_functiont &goto_function = it->second;
-        goto_programt &goto_program = goto_function.body;
+      (*it)->run(goto_functions);
+      ++it;
+      continue;
+    }
+
+    auto end = it;
+    while (end != algorithms.cend() && (*end)->is_function_local())
+      ++end;
+    run_local(goto_functions, it, end);
+    it = end;
+  }
+  return true;
+}
+
+void goto_function_pass_managert::run_local(
+  goto_functionst &goto_functions,
+  std::vector<goto_functions_algorithm *>::const_iterator begin,
+  std::vector<goto_functions_algorithm *>::const_iterator end)
+{
+  for (auto a = begin; a != end; ++a)
+    (*a)->runOnProgram(goto_functions);
 
-        // Foreach loop in the function
-        for (auto itt = function_loops.rbegin(); itt != function_loops.rend();
-             ++itt)
-          runOnLoop(*itt, goto_program);
+  Forall_goto_functions (it, goto_functions)
+  {
+    goto_programt &body = it->second.body;
+    for (auto a = begin; a != end; ++a)
+    {
+      // An earlier algorithm may have added instructions to this function,
+      // renumber it so that the loop detection of this one sees the right
+      // backward jumps. The final update() numbers the whole program again.
+      if (a != begin && (*a)->visits_loops() && !body.empty())
+      {
+        unsigned nr = body.instructions.front().location_number;
+        body.compute_location_numbers(nr);
       }
+      (*a)->run_on_function(*it, goto_functions);
     }
   }
+
   goto_functions.update();
-  return true;
 }
 
 bool goto_functions_algorithm::runOnLoop(loopst &, goto_programt &)
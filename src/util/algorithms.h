@@ -6,6 +6,7 @@
 #include <goto-programs/goto_loops.h>
 #include <goto-symex/symex_target_equation.h>
 #include <util/message.h>
+#include <functional>
 /**
  * @brief Base interface to run an algorithm in esbmc
  */
@@ -66,7 +67,33 @@ public:
     target_function = _tgt;
   }
 
+  /**
+   * @brief Says whether the algorithm only looks at and changes the
+   * function (and its loops) it is given, i.e. it has no whole-program
+   * step and its result on one function does not depend on the others.
+   * Such algorithms can be interleaved function by function with other
+   * local algorithms (see goto_function_pass_managert).
+   */
+  virtual bool is_function_local() const
+  {
+    return false;
+  }
+
 protected:
+  friend class goto_function_pass_managert;
+
+  /// Runs runOnFunction and then runOnLoop over a single function
+  void run_on_function(
+    std::pair<const dstring, goto_functiont> &F,
+    goto_functionst &goto_functions);
+
+  /// Whether runOnLoop does anything. The loops of a function are only
+  /// computed when it does.
+  virtual bool visits_loops() const
+  {
+    return true;
+  }
+
   virtual bool runOnFunction(std::pair<const dstring, goto_functiont> &F);
   virtual bool runOnLoop(loopst &loop, goto_programt &goto_program);
   virtual bool runOnProgram(goto_functionst &)
@@ -80,6 +107,103 @@ private:
   unsigned number_of_loops = 0;
 };
 
+/**
+ * @brief A function-local algorithm applying a transformation to each
+ * function in turn, e.g. remove_no_op or goto_check
+ */
+class goto_function_passt : public goto_functions_algorithm
+{
+public:
+  explicit goto_function_passt(std::function<void(goto_functiont &)> pass)
+    : goto_functions_algorithm(true), pass(std::move(pass))
+  {
+  }
+
+  bool is_function_local() const override
+  {
+    return true;
+  }
+
+protected:
+  bool runOnFunction(std::pair<const dstring, goto_functiont> &F) override
+  {
+    pass(F.second);
+    return true;
+  }
+
+  bool visits_loops() const override
+  {
+    return false;
+  }
+
+private:
+  std::function<void(goto_functiont &)> pass;
+};
+
+/**
+ * @brief An algorithm applying a transformation to the whole program at
+ * once, e.g. inlining or interval analysis
+ */
+class goto_program_passt : public goto_functions_algorithm
+{
+public:
+  explicit goto_program_passt(std::function<void(goto_functionst &)> pass)
+    : goto_functions_algorithm(true), pass(std::move(pass))
+  {
+  }
+
+protected:
+  bool runOnProgram(goto_functionst &goto_functions) override
+  {
+    pass(goto_functions);
+    return true;
+  }
+
+  bool visits_loops() const override
+  {
+    return false;
+  }
+
+private:
+  std::function<void(goto_functionst &)> pass;
+};
+
+/**
+ * @brief Runs a sequence of goto-functions algorithms. Consecutive
+ * function-local algorithms are fused into a single sweep over the
+ * functions, so each function body is visited once while it is hot
+ * instead of once per algorithm. Any other algorithm acts as a barrier
+ * and is run on its own over the whole program.
+ *
+ * The sweeps are sequential. They are where the functions would be
+ * handed to a pool of threads, which needs the following first:
+ * - atomic reference counts in irept, whose locations and types are
+ *   shared between functions once inlining copied bodies around
+ * - a synchronised string container
+ * - a lock around the symbol table, which mark_decl_as_non_det and
+ *   assign_params_as_non_det add symbols to
+ * Until then, the manager keeps the order of the passes and only
+ * improves locality.
+ */
+class goto_function_pass_managert
+{
+public:
+  void add(goto_functions_algorithm &algorithm)
+  {
+    algorithms.push_back(&algorithm);
+  }
+
+  bool run(goto_functionst &goto_functions);
+
+private:
+  void run_local(
+    goto_functionst &goto_functions,
+    std::vector<goto_functions_algorithm *>::const_iterator begin,
+    std::vector<goto_functions_algorithm *>::const_iterator end);
+
+  std::vector<goto_functions_algorithm *> algorithms;
+};
+
 /**
  * @brief Base interface for ssa-step algorithms
  */
@@ -0,0 +1,58 @@
+#include <fstream>
+#include <sstream>
+#include <util/content_hash.h>
+
+bool content_hash::read_file(const std::string &path, std::string &contents)
+{
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  if (!in)
+    return true;
+  std::ostringstream ss;
+  ss << in.rdbuf();
+  contents = ss.str();
+  return false;
+}
+
+std::string content_hash::hash_contents(const std::string &contents)
+{
+  crypto_hash h;
+  h.ingest(contents.data(), contents.size());
+  h.fin();
+  return h.to_string();
+}
+
+void content_hash::hash_string(crypto_hash &h, const std::string &s)
+{
+  // Include the terminator
+  h.ingest(s.c_str(), s.size() + 1);
+}
+
+bool content_hash::write_dependency(std::ostream &out, const std::string &path)
+{
+  std::string contents;
+  if (read_file(path, contents))
+    return true;
+  out << hash_contents(contents) << ' ' << path << '\n';
+  return false;
+}
+
+bool content_hash::dependencies_unchanged(const std::string &deps_path)
+{
+  std::ifstream in(deps_path);
+  if (!in)
+    return false;
+
+  std::string line, contents;
+  while (std::getline(in, line))
+  {
+    size_t sp = line.find(' ');
+    if (sp == std::string::npos)
+      return false;
+    if (read_file(line.substr(sp + 1), contents))
+      return false;
+    if (hash_contents(contents) != line.substr(0, sp))
+      return false;
+  }
+
+  return !in.bad();
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <util/crypto_hash.h>
+
+/**
+ * @brief Helpers for on-disk caches whose entries stay valid only while
+ *        the files they were built from keep their contents.
+ *
+ * The files an entry depends on are recorded one per line, as the digest of
+ * their contents followed by their path.
+ */
+
+namespace content_hash
+{
+/**
+ * @brief Reads the whole file at `path` into `contents`.
+ * @return true if the file could not be read
+ */
+bool read_file(const std::string &path, std::string &contents);
+
+/// Digest of `contents`, as a string
+std::string hash_contents(const std::string &contents);
+
+/// Adds `s` to `h`, such that consecutive strings stay apart
+void hash_string(crypto_hash &h, const std::string &s);
+
+/**
+ * @brief Records the current contents of the file at `path` in `out`.
+ * @return true if the file could not be read
+ */
+bool write_dependency(std::ostream &out, const std::string &path);
+
+/// Whether all files recorded in `deps_path` still have the same contents
+bool dependencies_unchanged(const std::string &deps_path);
+} // namespace content_hash
@@ -1,39 +1,121 @@
 #include <util/context.h>
+#include <cassert>
 #include <util/message.h>
 #include <util/message/format.h>
 
-bool contextt::add(const symbolt &symbol)
+const std::vector<irep_idt> &
+symbol_base_mapt::find(const irep_idt &base_name) const
 {
-  std::pair<symbolst::iterator, bool> result =
-    symbols.insert(std::pair<irep_idt, symbolt>(symbol.id, symbol));
+  static const std::vector<irep_idt> none;
+  auto it = map.find(base_name);
+  return it == map.end() ? none : it->second;
+}
 
-  if (!result.second)
-    return true;
+size_t symbol_indext::position(unsigned no) const
+{
+  size_t mask = slots.size() - 1;
+  size_t i = home(no);
+  while (slots[i].symbol && slots[i].no != no)
+    i = (i + 1) & mask;
+  return i;
+}
+
+symbolt *symbol_indext::find(const irep_idt &id) const
+{
+  if (slots.empty())
+    return nullptr;
+  return slots[position(id.get_no())].symbol;
+}
+
+void symbol_indext::grow()
+{
+  std::vector<slott> old(std::max<size_t>(16, slots.size() * 2));
+  old.swap(slots);
+  for (const slott &slot : old)
+    if (slot.symbol)
+      slots[position(slot.no)] = slot;
+}
+
+void symbol_indext::insert(const irep_idt &id, symbolt *symbol)
+{
+  // Keep the load factor under 3/4
+  if ((count + 1) * 4 > slots.size() * 3)
+    grow();
+
+  slott &slot = slots[position(id.get_no())];
+  assert(!slot.symbol);
+  slot.no = id.get_no();
+  slot.symbol = symbol;
+  count++;
+}
+
+symbolt *symbol_indext::erase(const irep_idt &id)
+{
+  if (slots.empty())
+    return nullptr;
+
+  size_t mask = slots.size() - 1;
+  size_t i = position(id.get_no());
+  symbolt *symbol = slots[i].symbol;
+  if (!symbol)
+    return nullptr;
+
+  // Shift back the entries after the hole that would no longer be found
+  // by probing from their home slot, rather than leaving a tombstone
+  slots[i].symbol = nullptr;
+  for (size_t j = (i + 1) & mask; slots[j].symbol; j = (j + 1) & mask)
+  {
+    size_t k = home(slots[j].no);
+    bool reachable = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+    if (reachable)
+      continue;
+    slots[i] = slots[j];
+    slots[j].symbol = nullptr;
+    i = j;
+  }
+
+  count--;
+  return symbol;
+}
 
-  symbol_base_map.insert(std::pair<irep_idt, irep_idt>(symbol.name, symbol.id));
+symbolt *contextt::new_symbol()
+{
+  if (free_symbols.empty())
+    return &symbol_pool.emplace_back();
 
-  ordered_symbols.push_back(&result.first->second);
+  symbolt *s = free_symbols.back();
+  free_symbols.pop_back();
+  return s;
+}
+
+bool contextt::add(const symbolt &symbol)
+{
+  if (symbols.find(symbol.id))
+    return true;
+
+  symbolt *s = new_symbol();
+  *s = symbol;
+  symbols.insert(symbol.id, s);
+  symbol_base_map.insert(symbol.name, symbol.id);
+  ordered_symbols.push_back(s);
   return false;
 }
 
 bool contextt::move(symbolt &symbol, symbolt *&new_symbol)
 {
-  symbolt tmp;
-  std::pair<symbolst::iterator, bool> result =
-    symbols.insert(std::pair<irep_idt, symbolt>(symbol.id, tmp));
-
-  if (!result.second)
+  if (symbolt *s = symbols.find(symbol.id))
   {
-    new_symbol = &result.first->second;
+    new_symbol = s;
     return true;
   }
 
-  symbol_base_map.insert(std::pair<irep_idt, irep_idt>(symbol.name, symbol.id));
-
-  ordered_symbols.push_back(&result.first->second);
+  symbolt *s = contextt::new_symbol();
+  symbols.insert(symbol.id, s);
+  symbol_base_map.insert(symbol.name, symbol.id);
+  ordered_symbols.push_back(s);
 
-  result.first->second.swap(symbol);
-  new_symbol = &result.first->second;
+  s->swap(symbol);
+  new_symbol = s;
   return false;
 }
 
@@ -46,51 +128,43 @@ void contextt::dump() const
 
 symbolt *contextt::find_symbol(irep_idt name)
 {
-  auto it = symbols.find(name);
-  if (it != symbols.end())
-    return &(it->second);
-  return nullptr;
+  return symbols.find(name);
 }
 
 const symbolt *contextt::find_symbol(irep_idt name) const
 {
-  auto it = symbols.find(name);
-  if (it != symbols.end())
-    return &(it->second);
-  return nullptr;
+  return symbols.find(name);
 }
 
 void contextt::erase_symbol(irep_idt name)
 {
-  symbolst::iterator it = symbols.find(name);
-  if (it == symbols.end())
+  symbolt *s = symbols.erase(name);
+  if (!s)
   {
     log_error("Couldn't find symbol to erase");
     abort();
   }
 
   ordered_symbols.erase(
-    std::remove_if(
-      ordered_symbols.begin(),
-      ordered_symbols.end(),
-      [&name](const symbolt *s) { return s->id == name; }),
+    std::remove(ordered_symbols.begin(), ordered_symbols.end(), s),
     ordered_symbols.end());
-  symbols.erase(it);
+  *s = symbolt();
+  free_symbols.push_back(s);
 }
 
 void contextt::foreach_operand_impl_const(const_symbol_delegate &expr) const
 {
-  for (const auto &symbol : symbols)
+  for (const symbolt *symbol : ordered_symbols)
   {
-    expr(symbol.second);
+    expr(*symbol);
   }
 }
 
 void contextt::foreach_operand_impl(symbol_delegate &expr)
 {
-  for (auto &symbol : symbols)
+  for (symbolt *symbol : ordered_symbols)
   {
-    expr(symbol.second);
+    expr(*symbol);
   }
 }
 
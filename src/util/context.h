@@ -1,9 +1,10 @@
 #ifndef CPROVER_CONTEXT_H
 #define CPROVER_CONTEXT_H
 
+#include <deque>
 #include <functional>
-
 #include <map>
+#include <unordered_map>
 #include <util/config.h>
 #include <util/symbol.h>
 #include <util/type.h>
@@ -11,17 +12,93 @@
 #  include <util/message.h>
 #endif
 
-typedef std::unordered_map<irep_idt, symbolt, irep_id_hash> symbolst;
 typedef std::vector<symbolt *> ordered_symbolst;
 
-typedef std::multimap<irep_idt, irep_idt> symbol_base_mapt;
+/**
+ * @brief Maps base names to the ids of the symbols carrying them, in the
+ * order the symbols were added. Ids of erased symbols are not removed.
+ */
+class symbol_base_mapt
+{
+public:
+  void insert(const irep_idt &base_name, const irep_idt &id)
+  {
+    map[base_name].push_back(id);
+  }
+
+  /// The ids of all symbols named base_name (possibly none)
+  const std::vector<irep_idt> &find(const irep_idt &base_name) const;
+
+  void clear()
+  {
+    map.clear();
+  }
+
+  void swap(symbol_base_mapt &other)
+  {
+    map.swap(other.map);
+  }
+
+private:
+  std::unordered_map<irep_idt, std::vector<irep_idt>, irep_id_hash> map;
+};
 
 #define forall_symbol_base_map(it, expr, base_name)                            \
-  for (symbol_base_mapt::const_iterator                                        \
-         it = (expr).lower_bound(base_name),                                   \
-         it_end = (expr).upper_bound(base_name);                               \
-       it != it_end;                                                           \
-       it++)
+  for (const irep_idt &it : (expr).find(base_name))
+
+/**
+ * @brief Open-addressing (linear probing) hash table from symbol ids to
+ * symbols, keyed on the dstring number of the id. The key is kept next to
+ * the pointer, so probing does not touch the symbols themselves.
+ */
+class symbol_indext
+{
+public:
+  symbolt *find(const irep_idt &id) const;
+
+  /// Adds a symbol under a key that is not in the table yet
+  void insert(const irep_idt &id, symbolt *symbol);
+
+  /// Removes a key, if present, and returns the symbol it mapped to
+  symbolt *erase(const irep_idt &id);
+
+  size_t size() const
+  {
+    return count;
+  }
+
+  void clear()
+  {
+    slots.clear();
+    count = 0;
+  }
+
+  void swap(symbol_indext &other)
+  {
+    slots.swap(other.slots);
+    std::swap(count, other.count);
+  }
+
+private:
+  struct slott
+  {
+    unsigned no;
+    symbolt *symbol; // nullptr for an empty slot
+  };
+
+  std::vector<slott> slots;
+  size_t count = 0;
+
+  size_t home(unsigned no) const
+  {
+    // Fibonacci hashing: dstring numbers are dense, spread them out
+    return (no * 0x9E3779B97F4A7C15ull >> 32) & (slots.size() - 1);
+  }
+
+  /// Position of `no`, or of the empty slot that ends its probe sequence
+  size_t position(unsigned no) const;
+  void grow();
+};
 
 class contextt
 {
@@ -29,7 +106,6 @@ class contextt
   typedef std::function<void(symbolt &symbol)> symbol_delegate;
 
 public:
-  typedef ::symbolst symbolst;
   typedef ::ordered_symbolst ordered_symbolst;
   explicit contextt()
   {
@@ -77,6 +153,8 @@ public:
     symbols.clear();
     symbol_base_map.clear();
     ordered_symbols.clear();
+    symbol_pool.clear();
+    free_symbols.clear();
   }
 
   DUMP_METHOD void dump() const;
@@ -86,6 +164,8 @@ public:
     symbols.swap(other.symbols);
     symbol_base_map.swap(other.symbol_base_map);
     ordered_symbols.swap(other.ordered_symbols);
+    symbol_pool.swap(other.symbol_pool);
+    free_symbols.swap(other.free_symbols);
   }
 
   symbolt *find_symbol(const char *name)
@@ -131,8 +211,15 @@ public:
   }
 
 private:
-  symbolst symbols;
+  symbol_indext symbols;
   ordered_symbolst ordered_symbols;
+  // Storage of the symbols: a deque never moves its elements, so pointers
+  // to symbols stay valid while others are added. Slots of erased symbols
+  // are reused.
+  std::deque<symbolt> symbol_pool;
+  std::vector<symbolt *> free_symbols;
+
+  symbolt *new_symbol();
 
   void foreach_operand_impl_const(const_symbol_delegate &expr) const;
   void foreach_operand_impl(symbol_delegate &expr);
@@ -23,6 +23,11 @@ bool crypto_hash::operator<(const crypto_hash &h2) const
   return false;
 }
 
+bool crypto_hash::operator==(const crypto_hash &h2) const
+{
+  return memcmp(hash, h2.hash, sizeof(hash)) == 0;
+}
+
 std::string crypto_hash::to_string() const
 {
   std::ostringstream buf;
@@ -1,6 +1,8 @@
 #ifndef _CPROVER_SRC_GOTO_SYMEX_CRYPTO_HASH_H_
 #define _CPROVER_SRC_GOTO_SYMEX_CRYPTO_HASH_H_
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -21,6 +23,7 @@ public:
   HashType hash[HASH_SIZE];
 
   bool operator<(const crypto_hash &h2) const;
+  bool operator==(const crypto_hash &h2) const;
 
   size_t to_size_t() const
   {
@@ -36,6 +39,26 @@ public:
   crypto_hash();
   void ingest(void const *data, unsigned int size);
   void fin();
+
+  /** Combine the digest of h into this one, order-independently. Applying
+   *  the same h twice cancels out, which allows incremental updates. */
+  void toggle(const crypto_hash &h)
+  {
+    for (int i = 0; i < HASH_SIZE; i++)
+      hash[i] ^= h.hash[i];
+  }
+};
+
+/** Hash functor for using crypto_hash in unordered containers. The digest is
+ *  already uniformly distributed, so its leading bytes are used directly. */
+struct crypto_hash_hash
+{
+  size_t operator()(const crypto_hash &h) const
+  {
+    size_t result = 0;
+    memcpy(&result, h.hash, std::min(sizeof(result), sizeof(h.hash)));
+    return result;
+  }
 };
 
 #endif /* _CPROVER_SRC_GOTO_SYMEX_CRYPTO_HASH_H_ */
@@ -11,11 +11,11 @@ code_function_callt get_destructor(const namespacet &ns, const typet &type)
   {
     const struct_typet &struct_type = to_struct_type(type);
 
-    auto it = ns.get_context().symbol_base_map.find(
+    const std::vector<irep_idt> &ids = ns.get_context().symbol_base_map.find(
       "~" + struct_type.tag().as_string());
-    if (it != ns.get_context().symbol_base_map.end())
+    if (!ids.empty())
     {
-      const symbolt *cpp_delete = ns.get_context().find_symbol(it->second);
+      const symbolt *cpp_delete = ns.get_context().find_symbol(ids.front());
 
       code_function_callt function_call;
       function_call.function() = symbol_exprt(cpp_delete->id, cpp_delete->type);
@@ -143,3 +143,13 @@ void file_operations::create_path_and_write(
 
   std::ofstream(path).write(s, n);
 }
+
+const std::string &file_operations::virtual_root()
+{
+#ifdef _WIN32
+  static const std::string root = "C:/esbmc-vfs";
+#else
+  static const std::string root = "/esbmc-vfs";
+#endif
+  return root;
+}
@@ -2,6 +2,8 @@
 
 #include <cstdio> /* FILE */
 #include <string>
+#include <utility>
+#include <vector>
 
 /**
  * @brief this file will contains helper functions for manipulating
@@ -109,4 +111,17 @@ tmp_path create_tmp_dir(const std::string &format = "esbmc.%%%%-%%%%-%%%%");
  * contents
  */
 void create_path_and_write(const std::string &path, const char *s, size_t n);
+
+/**
+ * @brief Files bundled into ESBMC that are handed to the frontends from
+ *        memory instead of being extracted to disk, as pairs of absolute path
+ *        and contents.
+ */
+typedef std::vector<std::pair<std::string, std::string>> virtual_filest;
+
+/**
+ * @brief Directory below which bundled files are mapped in memory. It does
+ *        not exist on disk.
+ */
+const std::string &virtual_root();
 } // namespace file_operations
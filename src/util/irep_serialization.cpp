@@ -148,8 +148,11 @@ void irep_serializationt::write_string_ref(std::ostream &out, const dstring &s)
   if (id >= ireps_container.string_map.size())
     ireps_container.string_map.resize(id + 1, false);
 
-  if (ireps_container.string_map[id])
+  if (ireps_container.string_map[id] || ireps_container.string_table)
+  {
+    ireps_container.string_map[id] = true;
     write_long(out, id);
+  }
   else
   {
     ireps_container.string_map[id] = true;
@@ -170,6 +173,7 @@ irep_idt irep_serializationt::read_string_ref(std::istream &in)
     return ireps_container.string_rev_map[id].second;
   }
 
+  assert(!ireps_container.string_table && "string missing from table");
   dstring s = read_string(in);
   ireps_container.string_rev_map[id] = std::pair<bool, dstring>(true, s);
   return ireps_container.string_rev_map[id].second;
@@ -63,6 +63,19 @@ public:
     typedef std::vector<std::pair<bool, dstring>> string_rev_mapt;
     string_rev_mapt string_rev_map;
 
+    /* When set, strings are kept in a separate table: references carry just
+     * the string's number and string_map collects the numbers written, while
+     * readers expect string_rev_map to be filled in beforehand. */
+    bool string_table = false;
+
+    /* Forget the ireps seen so far, but keep the strings, so that the next
+     * irep can be decoded without reading those before it. */
+    void clear_ireps()
+    {
+      ireps_on_write.clear();
+      ireps_on_read.clear();
+    }
+
     void clear()
     {
       ireps_on_write.clear();
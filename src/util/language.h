@@ -5,6 +5,7 @@
 #include <set>
 #include <util/context.h>
 #include <util/namespace.h>
+#include <vector>
 
 enum class presentationt
 {
@@ -18,6 +19,15 @@ public:
   // parse file
   virtual bool parse(const std::string &path) = 0;
 
+  // parse several files, in order; frontends may do so concurrently
+  virtual bool parse_files(const std::vector<std::string> &paths)
+  {
+    for (const std::string &path : paths)
+      if (parse(path))
+        return true;
+    return false;
+  }
+
   // final adjustments, e.g., initialization and call to main()
   virtual bool final(contextt &)
   {
@@ -1,5 +1,6 @@
 #include <cassert>
 #include <cstring>
+#include <util/expr_util.h>
 #include <util/namespace.h>
 #include <util/message.h>
 
@@ -20,6 +21,35 @@ const symbolt *namespacet::lookup(const irep_idt &name) const
   return context->find_symbol(name);
 }
 
+namespacet::migrated_symbolt &
+namespacet::lookup_migrated(const symbolt &symbol) const
+{
+  migrated_symbolt &entry = migrated[symbol.id];
+  if (
+    entry.type2 && full_eq(entry.type, symbol.type) &&
+    entry.name == symbol.name)
+    return entry;
+
+  entry.type = symbol.type;
+  entry.name = symbol.name;
+  entry.type2 = migrate_type(symbol.type);
+  entry.expr2 = expr2tc();
+  return entry;
+}
+
+const type2tc &namespacet::migrated_type(const symbolt &symbol) const
+{
+  return lookup_migrated(symbol).type2;
+}
+
+const expr2tc &namespacet::migrated_symbol_expr(const symbolt &symbol) const
+{
+  migrated_symbolt &entry = lookup_migrated(symbol);
+  if (is_nil_expr(entry.expr2))
+    migrate_expr(symbol_expr(symbol), entry.expr2);
+  return entry.expr2;
+}
+
 void namespacet::follow_symbol(irept &irep) const
 {
   while (irep.id() == "symbol")
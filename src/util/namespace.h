@@ -1,6 +1,7 @@
 #ifndef CPROVER_NAMESPACE_H
 #define CPROVER_NAMESPACE_H
 
+#include <unordered_map>
 #include <util/context.h>
 #include <irep2/irep2.h>
 #include <util/migrate.h>
@@ -35,6 +36,16 @@ public:
 
   virtual unsigned get_max(const std::string &prefix) const;
 
+  /**
+   * irep2 version of symbol.type. The migration happens on the first request
+   * for a symbol; later requests return the cached result for as long as the
+   * symbol's type is unchanged, which for shared ireps is a pointer compare.
+   */
+  const type2tc &migrated_type(const symbolt &symbol) const;
+
+  /** irep2 version of symbol_expr(symbol), cached like migrated_type(). */
+  const expr2tc &migrated_symbol_expr(const symbolt &symbol) const;
+
   const contextt &get_context() const
   {
     return *context;
@@ -42,6 +53,22 @@ public:
 
 protected:
   const contextt *context;
+
+  struct migrated_symbolt
+  {
+    // Copies of the legacy fields the cached results were built from. Holding
+    // them keeps the irep data shared, so any later write to the symbol
+    // detaches and is caught by the comparison in lookup_migrated().
+    typet type;
+    irep_idt name;
+    type2tc type2;
+    expr2tc expr2;
+  };
+
+  migrated_symbolt &lookup_migrated(const symbolt &symbol) const;
+
+  mutable std::unordered_map<irep_idt, migrated_symbolt, irep_id_hash>
+    migrated;
 };
 
 #endif
@@ -85,6 +85,34 @@ SCENARIO("bigint basic usage", "[bigint]")
   }
 }
 
+SCENARIO("bigint grows and shrinks past its inline digits", "[bigint]")
+{
+  GIVEN("A bigint with a int64 value")
+  {
+    BigInt obj(INT64_MAX);
+    WHEN("It is multiplied beyond 128 bits and divided back")
+    {
+      BigInt big = obj * obj * obj;
+      REQUIRE_FALSE(big.is_int64());
+      big /= obj;
+      big /= obj;
+      REQUIRE(big == obj);
+    }
+    WHEN("Values are swapped and moved between small and big ones")
+    {
+      BigInt big = obj * obj * obj;
+      BigInt copy = big;
+      obj.swap(big);
+      REQUIRE(obj == copy);
+      REQUIRE(big.to_int64() == INT64_MAX);
+      BigInt moved(std::move(obj));
+      REQUIRE(moved == copy);
+      moved = big;
+      REQUIRE(moved.to_int64() == INT64_MAX);
+    }
+  }
+}
+
 SCENARIO("bigint comparations", "[bigint]")
 {
   GIVEN("Two bigints with int64 values")
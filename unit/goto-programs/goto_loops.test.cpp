@@ -0,0 +1,89 @@
+/*******************************************************************
+ Module: Goto Programs loops unit test
+
+ Test Plan:
+   - Loops by loop number.
+   - Cached loops of a function.
+ \*******************************************************************/
+
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch2/catch.hpp>
+#include "../testing-utils/goto_factory.h"
+#include <goto-programs/goto_loops.h>
+#include <algorithm>
+
+static const char *nested_loops = "int main() {\n"
+                                  "  int a = 0;\n"
+                                  "  for(int i = 0; i < 5; i++) {\n"
+                                  "    a++;\n"
+                                  "    for(int j = 0; j < 4; j++)\n"
+                                  "      a--;\n"
+                                  "  }\n"
+                                  "  return a;\n"
+                                  "}\n";
+
+// ** Loops by loop number
+// Check whether every loop of a function is found through its number
+
+SCENARIO("goto_loopst finds a loop by its number", "[loops]")
+{
+  GIVEN("Nested loops")
+  {
+    std::istringstream src(nested_loops);
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    auto f = goto_functions.function_map.find("c:@F@main");
+    REQUIRE(f != goto_functions.function_map.end());
+
+    goto_loopst loops(f->first, goto_functions, f->second);
+    REQUIRE(loops.get_loops().size() == 2);
+
+    unsigned last = 0;
+    for (const loopst &loop : loops.get_loops())
+    {
+      unsigned number = loop.get_original_loop_exit()->loop_number;
+      REQUIRE(loops.get_loop(number) == &loop);
+      last = std::max(last, number);
+    }
+    REQUIRE(loops.get_loop(last + 1) == nullptr);
+  }
+}
+
+// ** Cached loops of a function
+// Check whether the loops are found once and kept until update()
+
+SCENARIO("goto_functionst caches the loops of a function", "[loops]")
+{
+  GIVEN("Nested loops")
+  {
+    std::istringstream src(nested_loops);
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    auto f = goto_functions.function_map.find("c:@F@main");
+    REQUIRE(f != goto_functions.function_map.end());
+
+    const goto_loopst &loops = goto_functions.get_function_loops(f);
+    REQUIRE(loops.get_loops().size() == 2);
+
+    WHEN("The loops are asked for again")
+    {
+      THEN("The same loops are returned")
+      {
+        REQUIRE(&goto_functions.get_function_loops(f) == &loops);
+      }
+    }
+    WHEN("The program is updated")
+    {
+      goto_functions.update();
+      const goto_loopst &found = goto_functions.get_function_loops(f);
+      THEN("The loops are found again")
+      {
+        REQUIRE(found.get_loops().size() == 2);
+        for (const loopst &loop : found.get_loops())
+          REQUIRE(
+            found.get_loop(loop.get_original_loop_exit()->loop_number) ==
+            &loop);
+      }
+    }
+  }
+}
@@ -1058,3 +1058,53 @@ TEST_CASE(
 
   T.run_configs();
 }
+
+TEST_CASE(
+  "Interval Analysis - Function Summaries",
+  "[ai][interval-analysis]")
+{
+  // Setup global options here
+  ait<interval_domaint> interval_analysis;
+  test_program T;
+  T.code =
+    "int g;\n"
+    "void store(int v) { g = v; }\n"
+    "void store_twenty() { store(20); }\n"
+    "int main() {\n"
+    "store(10);\n"
+    "store_twenty();\n"
+    "return g;\n" // g: [10,20]
+    "}";
+
+  T.property["7"].push_back({"@g", 10, true});
+  T.property["7"].push_back({"@g", 20, true});
+  T.property["7"].push_back({"@g", 21, false});
+
+  T.run_configs();
+}
+
+TEST_CASE(
+  "Interval Analysis - Function Summaries (visits)",
+  "[ai][interval-analysis]")
+{
+  // The calls reaching store() are all seen before its body, which is then
+  // analysed once for all of them rather than once per call
+  const unsigned calls = 8, statements = 32;
+  std::string code = "int g;\nvoid store(int v) {\n";
+  for (unsigned i = 0; i < statements; i++)
+    code += "g = v + " + std::to_string(i) + ";\n";
+  code += "}\nint main() {\nint x = nondet_int();\n";
+  for (unsigned i = 0; i < calls; i++)
+    code += "if (x == " + std::to_string(i) + ") store(" + std::to_string(i) +
+            ");\n";
+  code += "return g;\n}";
+
+  test_program::set_baseline_config();
+  auto P =
+    goto_factory::get_goto_functions(code, goto_factory::Architecture::BIT_32);
+  ait<interval_domaint> interval_analysis;
+  interval_analysis(P.functions, P.ns);
+
+  REQUIRE(interval_analysis.get_number_of_visits() > statements);
+  REQUIRE(interval_analysis.get_number_of_visits() < calls * statements);
+}
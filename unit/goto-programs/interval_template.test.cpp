@@ -317,6 +317,46 @@ TEST_CASE(
   }
 }
 
+TEST_CASE(
+  "Interval templates keep BigInt bounds exact past 64 bits",
+  "[ai][interval-analysis]")
+{
+  const BigInt max("9223372036854775807");
+  const BigInt min("-9223372036854775808");
+  const BigInt big("4294967296");
+
+  SECTION("Bounds that fit in a machine word")
+  {
+    interval_templatet<BigInt> A(-3, 5), B(-7, 2);
+    interval_templatet<BigInt> sum = A + B, diff = A - B, prod = A * B;
+    REQUIRE(*sum.lower == -10);
+    REQUIRE(*sum.upper == 7);
+    REQUIRE(*diff.lower == -5);
+    REQUIRE(*diff.upper == 12);
+    REQUIRE(*prod.lower == -35);
+    REQUIRE(*prod.upper == 21);
+  }
+
+  SECTION("Addition and subtraction overflowing int64_t")
+  {
+    interval_templatet<BigInt> A(min, max), B(-1, 1);
+    interval_templatet<BigInt> sum = A + B, diff = A - B;
+    REQUIRE(*sum.lower == min - 1);
+    REQUIRE(*sum.upper == max + 1);
+    REQUIRE(*diff.lower == min - 1);
+    REQUIRE(*diff.upper == max + 1);
+  }
+
+  SECTION("Multiplication overflowing int64_t")
+  {
+    interval_templatet<BigInt> A(-big, big);
+    interval_templatet<BigInt> prod = A * A;
+    REQUIRE(*prod.lower == -(big * big));
+    REQUIRE(*prod.upper == big * big);
+    REQUIRE(*prod.upper > max);
+  }
+}
+
 TEST_CASE("Wrapped Intervals tests", "[ai][interval-analysis]")
 {
   config.ansi_c.set_data_model(configt::ILP32);
@@ -7,12 +7,16 @@
 
  Test Plan:
    - Bounded loop unroller.
+   - Loop accelerator.
+   - Pass manager.
  \*******************************************************************/
 
 #define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
 #include <catch2/catch.hpp>
 #include "../testing-utils/goto_factory.h"
+#include <goto-programs/loop_acceleration.h>
 #include <goto-programs/loop_unroll.h>
+#include <util/algorithms.h>
 
 // ** Bounded loop unroller
 // Check whether the object converts a loop properly
@@ -117,3 +121,134 @@ SCENARIO("the loop unroller detects bounded loops", "[algorithms]")
     REQUIRE(unwind_loops.get_number_of_bounded_loops() == 2);
   }
 }
+
+// ** Loop accelerator
+// Check whether the object replaces only the loops it can summarise
+
+SCENARIO(
+  "the loop accelerator replaces simple counting loops",
+  "[algorithms]")
+{
+  GIVEN("A loop initialising a whole array")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int a[5]; "
+      "  for(int i = 0; i < 5; i++) a[i] = 7; "
+      "  return a[3]; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate_loops;
+    accelerate_loops.run(goto_functions);
+
+    REQUIRE(accelerate_loops.get_number_of_loops() == 1);
+    REQUIRE(accelerate_loops.get_number_of_accelerated_loops() == 1);
+
+    // The loop became a = ARRAY_OF(7)
+    unsigned array_of = 0;
+    forall_goto_program_instructions (
+      it, goto_functions.function_map["c:@F@main"].body)
+    {
+      REQUIRE(!it->is_backwards_goto());
+      if (
+        it->is_assign() &&
+        is_constant_array_of2t(to_code_assign2t(it->code).source))
+        array_of++;
+    }
+    REQUIRE(array_of == 1);
+  }
+  GIVEN("Loops indexing the array through a cast")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int a[300]; "
+      "  for(int i = 0; i < 300; i++) a[(long)i] = 7; "
+      "  for(int i = 0; i < 300; i++) a[(unsigned char)i] = 7; "
+      "  return a[299]; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate_loops;
+    accelerate_loops.run(goto_functions);
+
+    // Only the cast that keeps every index apart is accepted
+    REQUIRE(accelerate_loops.get_number_of_loops() == 2);
+    REQUIRE(accelerate_loops.get_number_of_accelerated_loops() == 1);
+  }
+  GIVEN("A loop accumulating an unsigned value")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  unsigned s = nondet_uint(); "
+      "  for(int i = 2; i < 10; i++) s = s + 3; "
+      "  return s; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate_loops;
+    accelerate_loops.run(goto_functions);
+
+    REQUIRE(accelerate_loops.get_number_of_loops() == 1);
+    REQUIRE(accelerate_loops.get_number_of_accelerated_loops() == 1);
+  }
+  GIVEN("Loops that depend on the iteration")
+  {
+    std::istringstream src(
+      "int main() { "
+      "  int a[5]; "
+      "  int s = 0; "
+      "  for(int i = 0; i < 5; i++) a[i] = i; "
+      "  for(int i = 0; i < 4; i++) a[i] = 1; "
+      "  for(int i = 0; i < 5; i++) s = s + 1; "
+      "  for(int i = 0; i < 5; i++) a[i] = nondet_int(); "
+      "  return 0; "
+      "}");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    loop_accelerator accelerate_loops;
+    accelerate_loops.run(goto_functions);
+
+    REQUIRE(accelerate_loops.get_number_of_loops() == 4);
+    REQUIRE(accelerate_loops.get_number_of_accelerated_loops() == 0);
+  }
+}
+
+// ** Pass manager
+// Check that consecutive local passes visit each function in turn, and
+// that other passes run on their own in between
+
+SCENARIO("the pass manager fuses function-local passes", "[algorithms]")
+{
+  GIVEN("Local passes around a whole-program pass")
+  {
+    std::istringstream src(
+      "int f() { return 1; }"
+      "int main() { return f(); }");
+    program P = goto_factory::get_goto_functions(src);
+    auto &goto_functions = P.functions;
+    size_t functions = goto_functions.function_map.size();
+    REQUIRE(functions > 1);
+
+    std::string trace;
+    auto record = [&trace](char c) {
+      return [&trace, c](goto_functiont &) { trace += c; };
+    };
+    goto_function_passt a(record('a')), b(record('b')), d(record('d'));
+    goto_program_passt c([&trace](goto_functionst &) { trace += 'c'; });
+
+    goto_function_pass_managert passes;
+    passes.add(a);
+    passes.add(b);
+    passes.add(c);
+    passes.add(d);
+    passes.run(goto_functions);
+
+    std::string expected;
+    for (size_t i = 0; i < functions; i++)
+      expected += "ab";
+    expected += 'c';
+    expected += std::string(functions, 'd');
+    REQUIRE(trace == expected);
+  }
+}
@@ -0,0 +1,78 @@
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
+
+#include <catch2/catch.hpp>
+#include <solidity-frontend/solidity_convert.h>
+#include <nlohmann/json.hpp>
+
+TEST_CASE("Parse a block of solc's JSON AST")
+{
+  const std::string block = R"json({
+    "absolutePath": "example.sol",
+    "license": "GPL-3.0",
+    "nodeType": "SourceUnit",
+    "nodes": [
+      {
+        "baseFunctions": [1],
+        "documentation": {"nodeType": "StructuredDocumentation"},
+        "functionSelector": "26121ff0",
+        "id": 7,
+        "modifiers": [],
+        "name": "documentation",
+        "nodeType": "FunctionDefinition",
+        "overrides": null,
+        "stateMutability": "pure",
+        "visibility": "public",
+        "body": {
+          "nodeType": "Block",
+          "statements": [
+            {
+              "isConstant": false,
+              "isLValue": false,
+              "isPure": true,
+              "lValueRequested": false,
+              "nodeType": "Identifier",
+              "overloadedDeclarations": [],
+              "referencedDeclaration": 3,
+              "storageLocation": "default",
+              "typeDescriptions": {"typeString": "uint8"}
+            }
+          ]
+        }
+      }
+    ]
+  })json";
+
+  nlohmann::json ast = solidity_convertert::parse_json_block(block);
+  const nlohmann::json &function = ast["nodes"][0];
+  const nlohmann::json &statement = function["body"]["statements"][0];
+
+  SECTION("Unused keys are dropped at any depth")
+  {
+    REQUIRE(solidity_convertert::unused_keys.size() == 12);
+    for (const std::string &key : solidity_convertert::unused_keys)
+    {
+      CAPTURE(key);
+      REQUIRE_FALSE(ast.contains(key));
+      REQUIRE_FALSE(function.contains(key));
+      REQUIRE_FALSE(statement.contains(key));
+    }
+  }
+
+  SECTION("Keys the converter reads are kept")
+  {
+    REQUIRE(ast["absolutePath"] == "example.sol");
+    REQUIRE(ast["nodeType"] == "SourceUnit");
+    REQUIRE(function["id"] == 7);
+    REQUIRE(function["nodeType"] == "FunctionDefinition");
+    REQUIRE(function["stateMutability"] == "pure");
+    REQUIRE(function["visibility"] == "public");
+    REQUIRE(statement["nodeType"] == "Identifier");
+    REQUIRE(statement["referencedDeclaration"] == 3);
+    REQUIRE(statement["typeDescriptions"]["typeString"] == "uint8");
+  }
+
+  SECTION("Values equal to an unused key are kept")
+  {
+    REQUIRE(function["name"] == "documentation");
+  }
+}
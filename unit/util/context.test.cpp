@@ -0,0 +1,89 @@
+/// \file Tests of the symbol table (contextt)
+
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch2/catch.hpp>
+#include <util/context.h>
+
+static symbolt make_symbol(const std::string &id, const std::string &name)
+{
+  symbolt s;
+  s.id = id;
+  s.name = name;
+  return s;
+}
+
+SCENARIO("contextt lookups", "[core][utils][context]")
+{
+  GIVEN("A context with many symbols")
+  {
+    contextt context;
+    const unsigned n = 10000;
+    for (unsigned i = 0; i < n; i++)
+      REQUIRE(!context.add(make_symbol("c:@F@f" + std::to_string(i), "f")));
+
+    THEN("All of them can be found and they are kept in order")
+    {
+      REQUIRE(context.size() == n);
+      for (unsigned i = 0; i < n; i++)
+      {
+        const symbolt *s = context.find_symbol("c:@F@f" + std::to_string(i));
+        REQUIRE(s != nullptr);
+        REQUIRE(s->id == "c:@F@f" + std::to_string(i));
+      }
+      REQUIRE(context.find_symbol("c:@F@g") == nullptr);
+
+      unsigned i = 0;
+      context.foreach_operand_in_order([&i](const symbolt &s) {
+        REQUIRE(s.id == "c:@F@f" + std::to_string(i++));
+      });
+      REQUIRE(i == n);
+    }
+
+    THEN("Adding an existing symbol fails")
+    {
+      REQUIRE(context.add(make_symbol("c:@F@f42", "g")));
+      symbolt s = make_symbol("c:@F@f42", "g");
+      symbolt *existing;
+      REQUIRE(context.move(s, existing));
+      REQUIRE(existing == context.find_symbol("c:@F@f42"));
+      REQUIRE(existing->name == "f");
+    }
+
+    THEN("Symbols stay in place when more are added")
+    {
+      const symbolt *s = context.find_symbol("c:@F@f0");
+      for (unsigned i = 0; i < n; i++)
+        context.add(make_symbol("c:@F@h" + std::to_string(i), "h"));
+      REQUIRE(context.find_symbol("c:@F@f0") == s);
+    }
+
+    THEN("Erased symbols are no longer found and the others still are")
+    {
+      for (unsigned i = 0; i < n; i += 3)
+        context.erase_symbol("c:@F@f" + std::to_string(i));
+
+      for (unsigned i = 0; i < n; i++)
+      {
+        const symbolt *s = context.find_symbol("c:@F@f" + std::to_string(i));
+        REQUIRE((s == nullptr) == (i % 3 == 0));
+      }
+
+      unsigned count = 0;
+      context.foreach_operand([&count](const symbolt &) { count++; });
+      REQUIRE(count == context.size());
+      REQUIRE(count == n - (n + 2) / 3);
+
+      REQUIRE(!context.add(make_symbol("c:@F@f0", "f")));
+      REQUIRE(context.find_symbol("c:@F@f0") != nullptr);
+    }
+
+    THEN("Symbols can be found by their base name")
+    {
+      unsigned count = 0;
+      forall_symbol_base_map (id, context.symbol_base_map, "f")
+        REQUIRE(id == "c:@F@f" + std::to_string(count++));
+      REQUIRE(count == n);
+      REQUIRE(context.symbol_base_map.find("g").empty());
+    }
+  }
+}